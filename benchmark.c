@@ -1,100 +1,703 @@
+// In-process benchmark harness - links the solvers directly instead of
+// running sudoku_advanced and scraping its output.
+//
+// Every (puzzle, engine, thread count) gets a few warm-up solves, then is
+// repeated until the 95% confidence interval of the mean is tight enough
+// (or a run/time limit is hit). Times come from a nanosecond clock, so
+// sub-millisecond solves are measured properly.
+//
+// With --corpus the harness switches to throughput mode: every puzzle of
+// each one-per-line corpus file is solved once per engine/thread count and
+// we report puzzles/sec, nodes/sec and the latency distribution per corpus.
+//
+// --scaling strong|weak sweeps thread counts over a corpus: strong keeps the
+// puzzle set fixed, weak grows it with the thread count (--batch puzzles per
+// thread). Each point reports speedup and parallel efficiency against the
+// first thread count, and splits threads * wall time into useful search,
+// redundant search (after the puzzle was already solved), sync and idle
+// using the time accounting in SolverStats.
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <math.h>
 #include <omp.h>
 
-#define N 9
-#define NUM_RUNS 5
-#define MAX_THREADS 16
+#include "sudoku_advanced.h"
+
+#define DEFAULT_WARMUP 3
+#define DEFAULT_MIN_RUNS 10
+#define DEFAULT_MAX_RUNS 2000
+#define DEFAULT_TARGET_CI 0.02     // stop once the 95% CI is within +-2% of the mean
+#define DEFAULT_MAX_SECONDS 5.0    // per puzzle/engine/thread count
+#define MAX_PUZZLES 64
+#define MAX_THREAD_COUNTS 16
+#define MAX_CORPORA 16
+#define DEFAULT_BATCH 8            // weak scaling puzzles per thread
+#define DEFAULT_SCALING_CORPUS "corpus/hardest.txt"
 
 typedef struct {
-    double serial_time;
-    double parallel_v1_time;
-    double parallel_v2_time;
-    double parallel_v3_time;
+    int warmup;
+    int min_runs;
+    int max_runs;
+    double target_ci;
+    double max_seconds;
+    int thread_counts[MAX_THREAD_COUNTS];
+    int num_thread_counts;
+    int engine_enabled[NUM_ENGINES];
+    const char *csv_file;
+    const char *json_file;
+    const char *corpora[MAX_CORPORA];
+    int num_corpora;
+    int limit;  // max puzzles per corpus, 0 = all
+    const char *scaling;  // "strong", "weak" or NULL
+    int batch;
+    SolveLimits limits;   // per solve; a timed-out solve counts as a failure
+} BenchmarkOptions;
+
+typedef struct {
+    char puzzle[64];
+    const char *engine;
+    int threads;
+    int runs;
+    double mean_ns, stddev_ns, ci95_ns;
+    double min_ns, median_ns, p90_ns, p99_ns;
+    unsigned long long nodes, backtracks;  // from the last run
+    int solved, verified;
+    double speedup;  // serial median / this median, same puzzle (0 if no serial run)
 } BenchmarkResult;
 
-void run_benchmark(const char *puzzle_file, const char *puzzle_name, int num_threads, FILE *output) {
-    char command[512];
-    BenchmarkResult results[NUM_RUNS];
-    
-    printf("Benchmarking %s with %d threads (%d runs)...\n", puzzle_name, num_threads, NUM_RUNS);
-    
-    for (int run = 0; run < NUM_RUNS; run++) {
-        sprintf(command, "set OMP_NUM_THREADS=%d && sudoku_advanced.exe %s", num_threads, puzzle_file);
-        
-        // Execute and parse results (simplified - you'd need to capture output properly)
-        FILE *fp = _popen(command, "r");
-        if (fp) {
-            char line[256];
-            while (fgets(line, sizeof(line), fp)) {
-                if (strstr(line, "Serial:")) {
-                    sscanf(line, "║ Serial: %lf", &results[run].serial_time);
-                } else if (strstr(line, "Parallel V1:")) {
-                    sscanf(line, "║ Parallel V1: %lf", &results[run].parallel_v1_time);
-                } else if (strstr(line, "Parallel V2:")) {
-                    sscanf(line, "║ Parallel V2: %lf", &results[run].parallel_v2_time);
-                } else if (strstr(line, "Parallel V3:")) {
-                    sscanf(line, "║ Parallel V3: %lf", &results[run].parallel_v3_time);
+typedef struct {
+    char corpus[64];
+    const char *engine;
+    int threads;
+    int puzzles;
+    int failures;  // not solved or wrong solution
+    double total_s;
+    double puzzles_per_sec, nodes_per_sec;
+    double median_us, p90_us, p99_us, max_us;
+} CorpusResult;
+
+typedef struct {
+    char corpus[64];
+    const char *mode;
+    const char *engine;
+    int threads;
+    int puzzles;
+    int failures;
+    double wall_s;
+    double speedup, efficiency;  // against the first thread count
+    double useful_s, redundant_s, sync_s, idle_s;  // summed over threads
+} ScalingResult;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Linear interpolation between closest ranks, samples must be sorted
+static double percentile(const double *sorted, int n, double p) {
+    double rank = p * (n - 1);
+    int lo = (int)rank;
+    int hi = lo + 1 < n ? lo + 1 : lo;
+    return sorted[lo] + (rank - lo) * (sorted[hi] - sorted[lo]);
+}
+
+static void puzzle_name(const char *path, char *name, size_t size) {
+    const char *base = strrchr(path, '/');
+    const char *base2 = strrchr(path, '\\');
+    if (base2 > base) base = base2;
+    base = base ? base + 1 : path;
+
+    snprintf(name, size, "%s", base);
+    char *dot = strrchr(name, '.');
+    if (dot) *dot = '\0';
+}
+
+static void run_benchmark(SudokuGrid *puzzle, const SolverEngine *engine, int threads,
+                          const BenchmarkOptions *opt, double *samples, BenchmarkResult *res) {
+    SudokuGrid grid;
+    SolverStats stats;
+
+    omp_set_num_threads(threads);
+    res->engine = engine->name;
+    res->threads = threads;
+
+    for (int i = 0; i < opt->warmup; i++) {
+        copy_grid(puzzle, &grid);
+        engine->solve(&grid, &stats, &opt->limits);
+    }
+
+    // Welford running mean/variance so we can check the CI after every run
+    double mean = 0, m2 = 0;
+    double deadline = now_ns() + opt->max_seconds * 1e9;
+    int n = 0;
+
+    while (n < opt->max_runs) {
+        copy_grid(puzzle, &grid);
+        double start = now_ns();
+        res->solved = engine->solve(&grid, &stats, &opt->limits) == 1;
+        double elapsed = now_ns() - start;
+
+        samples[n++] = elapsed;
+        double delta = elapsed - mean;
+        mean += delta / n;
+        m2 += delta * (elapsed - mean);
+
+        if (n >= opt->min_runs) {
+            double sd = sqrt(m2 / (n - 1));
+            if (1.96 * sd / sqrt(n) <= opt->target_ci * mean) break;
+            if (now_ns() > deadline) break;
+        }
+    }
+
+    res->verified = res->solved && verify_solution(&grid);
+    res->nodes = stats.nodes_explored;
+    res->backtracks = stats.backtrack_count;
+
+    res->runs = n;
+    res->mean_ns = mean;
+    res->stddev_ns = n > 1 ? sqrt(m2 / (n - 1)) : 0;
+    res->ci95_ns = n > 1 ? 1.96 * res->stddev_ns / sqrt(n) : 0;
+
+    qsort(samples, n, sizeof(double), compare_double);
+    res->min_ns = samples[0];
+    res->median_ns = percentile(samples, n, 0.50);
+    res->p90_ns = percentile(samples, n, 0.90);
+    res->p99_ns = percentile(samples, n, 0.99);
+}
+
+// Throughput over a whole corpus - each puzzle solved once, in file order
+static void run_corpus(SudokuGrid *puzzles, int count, const SolverEngine *engine, int threads,
+                       const BenchmarkOptions *opt, double *samples, CorpusResult *res) {
+    SudokuGrid grid;
+    SolverStats stats;
+    unsigned long long nodes = 0;
+
+    omp_set_num_threads(threads);
+    res->engine = engine->name;
+    res->threads = threads;
+    res->failures = 0;
+
+    for (int i = 0; i < opt->warmup && i < count; i++) {
+        copy_grid(&puzzles[i], &grid);
+        engine->solve(&grid, &stats, &opt->limits);
+    }
+
+    double total = 0;
+    for (int i = 0; i < count; i++) {
+        copy_grid(&puzzles[i], &grid);
+        double start = now_ns();
+        int solved = engine->solve(&grid, &stats, &opt->limits) == 1;
+        samples[i] = now_ns() - start;
+
+        total += samples[i];
+        nodes += stats.nodes_explored;
+        if (!solved || !verify_solution(&grid)) res->failures++;
+    }
+
+    qsort(samples, count, sizeof(double), compare_double);
+    res->puzzles = count;
+    res->total_s = total / 1e9;
+    res->puzzles_per_sec = count / res->total_s;
+    res->nodes_per_sec = nodes / res->total_s;
+    res->median_us = percentile(samples, count, 0.50) / 1000;
+    res->p90_us = percentile(samples, count, 0.90) / 1000;
+    res->p99_us = percentile(samples, count, 0.99) / 1000;
+    res->max_us = samples[count - 1] / 1000;
+}
+
+static void write_corpus_csv(const char *filename, CorpusResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "corpus,engine,threads,puzzles,failures,total_s,puzzles_per_sec,nodes_per_sec,"
+               "median_us,p90_us,p99_us,max_us\n");
+    for (int i = 0; i < count; i++) {
+        CorpusResult *r = &results[i];
+        fprintf(f, "%s,%s,%d,%d,%d,%.6f,%.1f,%.1f,%.2f,%.2f,%.2f,%.2f\n",
+                r->corpus, r->engine, r->threads, r->puzzles, r->failures, r->total_s,
+                r->puzzles_per_sec, r->nodes_per_sec, r->median_us, r->p90_us, r->p99_us, r->max_us);
+    }
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static void write_corpus_json(const char *filename, CorpusResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "[\n");
+    for (int i = 0; i < count; i++) {
+        CorpusResult *r = &results[i];
+        fprintf(f, "  {\"corpus\": \"%s\", \"engine\": \"%s\", \"threads\": %d, \"puzzles\": %d, "
+                   "\"failures\": %d, \"total_s\": %.6f, \"puzzles_per_sec\": %.1f, \"nodes_per_sec\": %.1f, "
+                   "\"median_us\": %.2f, \"p90_us\": %.2f, \"p99_us\": %.2f, \"max_us\": %.2f}%s\n",
+                r->corpus, r->engine, r->threads, r->puzzles, r->failures, r->total_s,
+                r->puzzles_per_sec, r->nodes_per_sec, r->median_us, r->p90_us, r->p99_us, r->max_us,
+                i + 1 < count ? "," : "");
+    }
+    fprintf(f, "]\n");
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static int benchmark_corpora(const BenchmarkOptions *opt) {
+    int max_results = opt->num_corpora * NUM_ENGINES * opt->num_thread_counts;
+    CorpusResult *results = calloc(max_results, sizeof(CorpusResult));
+    if (!results) {
+        printf("Error: Out of memory\n");
+        return 1;
+    }
+    int count = 0;
+
+    printf("%-12s %-10s %3s %7s %5s %12s %14s %11s %11s %11s %11s\n",
+           "Corpus", "Engine", "Thr", "Puzzles", "Fail", "Puzzles/s", "Nodes/s",
+           "Median(us)", "P90(us)", "P99(us)", "Max(us)");
+
+    for (int c = 0; c < opt->num_corpora; c++) {
+        SudokuGrid *puzzles;
+        int num_puzzles = load_puzzle_batch(opt->corpora[c], &puzzles);
+        if (opt->limit > 0 && num_puzzles > opt->limit) num_puzzles = opt->limit;
+        if (num_puzzles == 0) {
+            printf("Warning: %s has no puzzles\n", opt->corpora[c]);
+            free(puzzles);
+            continue;
+        }
+
+        double *samples = malloc(num_puzzles * sizeof(double));
+        char name[64];
+        puzzle_name(opt->corpora[c], name, sizeof(name));
+
+        for (int e = 0; e < NUM_ENGINES; e++) {
+            if (!opt->engine_enabled[e]) continue;
+
+            for (int t = 0; t < opt->num_thread_counts; t++) {
+                if (!solver_engines[e].parallel && t > 0) break;
+                int threads = solver_engines[e].parallel ? opt->thread_counts[t] : 1;
+
+                CorpusResult *r = &results[count++];
+                snprintf(r->corpus, sizeof(r->corpus), "%s", name);
+                run_corpus(puzzles, num_puzzles, &solver_engines[e], threads, opt, samples, r);
+
+                printf("%-12s %-10s %3d %7d %5d %12.1f %14.1f %11.2f %11.2f %11.2f %11.2f\n",
+                       r->corpus, r->engine, r->threads, r->puzzles, r->failures,
+                       r->puzzles_per_sec, r->nodes_per_sec,
+                       r->median_us, r->p90_us, r->p99_us, r->max_us);
+            }
+        }
+
+        free(samples);
+        free(puzzles);
+    }
+
+    if (opt->csv_file) write_corpus_csv(opt->csv_file, results, count);
+    if (opt->json_file) write_corpus_json(opt->json_file, results, count);
+
+    free(results);
+    return 0;
+}
+
+// One pass over count puzzles (cycling through the corpus), summing wall time
+// and the per-thread time breakdown the engines report
+static void run_scaling(SudokuGrid *puzzles, int num_puzzles, int count, const SolverEngine *engine,
+                        int threads, const BenchmarkOptions *opt, ScalingResult *res) {
+    SudokuGrid grid;
+    SolverStats stats;
+    double search = 0, redundant = 0, sync = 0;
+
+    omp_set_num_threads(threads);
+    res->engine = engine->name;
+    res->threads = threads;
+    res->puzzles = count;
+    res->failures = 0;
+    res->wall_s = 0;
+
+    for (int i = 0; i < opt->warmup && i < num_puzzles; i++) {
+        copy_grid(&puzzles[i], &grid);
+        engine->solve(&grid, &stats, &opt->limits);
+    }
+
+    for (int i = 0; i < count; i++) {
+        copy_grid(&puzzles[i % num_puzzles], &grid);
+        double start = now_ns();
+        int solved = engine->solve(&grid, &stats, &opt->limits) == 1;
+        res->wall_s += (now_ns() - start) / 1e9;
+
+        search += stats.search_time;
+        redundant += stats.redundant_time;
+        sync += stats.sync_time;
+        if (!solved || !verify_solution(&grid)) res->failures++;
+    }
+
+    // Idle is measured against the threads we asked for, so an engine that
+    // falls back to one thread on easy puzzles shows up as idle, not efficient
+    double idle = threads * res->wall_s - search - sync;
+    res->useful_s = search - redundant;
+    res->redundant_s = redundant;
+    res->sync_s = sync;
+    res->idle_s = idle > 0 ? idle : 0;
+}
+
+static void write_scaling_csv(const char *filename, ScalingResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "mode,corpus,engine,threads,puzzles,failures,wall_s,speedup,efficiency,"
+               "useful_s,redundant_s,sync_s,idle_s\n");
+    for (int i = 0; i < count; i++) {
+        ScalingResult *r = &results[i];
+        fprintf(f, "%s,%s,%s,%d,%d,%d,%.6f,%.3f,%.3f,%.6f,%.6f,%.6f,%.6f\n",
+                r->mode, r->corpus, r->engine, r->threads, r->puzzles, r->failures, r->wall_s,
+                r->speedup, r->efficiency, r->useful_s, r->redundant_s, r->sync_s, r->idle_s);
+    }
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static void write_scaling_json(const char *filename, ScalingResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "[\n");
+    for (int i = 0; i < count; i++) {
+        ScalingResult *r = &results[i];
+        fprintf(f, "  {\"mode\": \"%s\", \"corpus\": \"%s\", \"engine\": \"%s\", \"threads\": %d, "
+                   "\"puzzles\": %d, \"failures\": %d, \"wall_s\": %.6f, \"speedup\": %.3f, "
+                   "\"efficiency\": %.3f, \"useful_s\": %.6f, \"redundant_s\": %.6f, "
+                   "\"sync_s\": %.6f, \"idle_s\": %.6f}%s\n",
+                r->mode, r->corpus, r->engine, r->threads, r->puzzles, r->failures, r->wall_s,
+                r->speedup, r->efficiency, r->useful_s, r->redundant_s, r->sync_s, r->idle_s,
+                i + 1 < count ? "," : "");
+    }
+    fprintf(f, "]\n");
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static int benchmark_scaling(const BenchmarkOptions *opt) {
+    int weak = strcmp(opt->scaling, "weak") == 0;
+    int max_results = opt->num_corpora * NUM_ENGINES * opt->num_thread_counts;
+    ScalingResult *results = calloc(max_results, sizeof(ScalingResult));
+    if (!results) {
+        printf("Error: Out of memory\n");
+        return 1;
+    }
+    int count = 0;
+
+    printf("%s scaling, baseline = %d thread(s)%s\n\n", weak ? "Weak" : "Strong",
+           opt->thread_counts[0], weak ? ", batch grows with threads" : "");
+    printf("%-12s %-10s %3s %7s %5s %10s %8s %7s %8s %10s %7s %7s\n",
+           "Corpus", "Engine", "Thr", "Puzzles", "Fail", "Wall(s)", "Speedup", "Eff(%)",
+           "Useful%", "Redundant%", "Sync%", "Idle%");
+
+    for (int c = 0; c < opt->num_corpora; c++) {
+        SudokuGrid *puzzles;
+        int num_puzzles = load_puzzle_batch(opt->corpora[c], &puzzles);
+        if (opt->limit > 0 && num_puzzles > opt->limit) num_puzzles = opt->limit;
+        if (num_puzzles == 0) {
+            printf("Warning: %s has no puzzles\n", opt->corpora[c]);
+            free(puzzles);
+            continue;
+        }
+
+        char name[64];
+        puzzle_name(opt->corpora[c], name, sizeof(name));
+
+        for (int e = 0; e < NUM_ENGINES; e++) {
+            if (!opt->engine_enabled[e]) continue;
+            double base_wall = 0;
+
+            for (int t = 0; t < opt->num_thread_counts; t++) {
+                if (!solver_engines[e].parallel && t > 0) break;
+                int threads = solver_engines[e].parallel ? opt->thread_counts[t] : 1;
+                int batch = weak ? opt->batch * threads : num_puzzles;
+
+                ScalingResult *r = &results[count++];
+                snprintf(r->corpus, sizeof(r->corpus), "%s", name);
+                r->mode = weak ? "weak" : "strong";
+                run_scaling(puzzles, num_puzzles, batch, &solver_engines[e], threads, opt, r);
+
+                // Strong: same work, so speedup = T(base) / T(P). Weak: work per
+                // thread is fixed, so efficiency = T(base) / T(P) and the speedup
+                // is the scaled one.
+                if (t == 0) base_wall = r->wall_s;
+                double ratio = threads / (double)(solver_engines[e].parallel ? opt->thread_counts[0] : 1);
+                if (weak) {
+                    r->efficiency = base_wall / r->wall_s;
+                    r->speedup = r->efficiency * ratio;
+                } else {
+                    r->speedup = base_wall / r->wall_s;
+                    r->efficiency = r->speedup / ratio;
                 }
+
+                double thread_s = threads * r->wall_s;
+                printf("%-12s %-10s %3d %7d %5d %10.4f %7.2fx %7.1f %8.1f %10.1f %7.1f %7.1f\n",
+                       r->corpus, r->engine, r->threads, r->puzzles, r->failures, r->wall_s,
+                       r->speedup, 100 * r->efficiency,
+                       100 * r->useful_s / thread_s, 100 * r->redundant_s / thread_s,
+                       100 * r->sync_s / thread_s, 100 * r->idle_s / thread_s);
             }
-            _pclose(fp);
         }
+
+        free(puzzles);
+    }
+
+    if (opt->csv_file) write_scaling_csv(opt->csv_file, results, count);
+    if (opt->json_file) write_scaling_json(opt->json_file, results, count);
+
+    free(results);
+    return 0;
+}
+
+static void write_csv(const char *filename, BenchmarkResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
     }
-    
-    // Calculate averages
-    double avg_serial = 0, avg_v1 = 0, avg_v2 = 0, avg_v3 = 0;
-    for (int i = 0; i < NUM_RUNS; i++) {
-        avg_serial += results[i].serial_time;
-        avg_v1 += results[i].parallel_v1_time;
-        avg_v2 += results[i].parallel_v2_time;
-        avg_v3 += results[i].parallel_v3_time;
-    }
-    avg_serial /= NUM_RUNS;
-    avg_v1 /= NUM_RUNS;
-    avg_v2 /= NUM_RUNS;
-    avg_v3 /= NUM_RUNS;
-    
-    // Write to CSV
-    fprintf(output, "%d,%s,%.6f,%.6f,%.6f,%.6f,%.2f,%.2f,%.2f\n",
-            num_threads, puzzle_name,
-            avg_serial, avg_v1, avg_v2, avg_v3,
-            avg_serial / avg_v1, avg_serial / avg_v2, avg_serial / avg_v3);
-    
-    printf("  Average times: Serial=%.6fs, V1=%.6fs (%.2fx), V2=%.6fs (%.2fx), V3=%.6fs (%.2fx)\n\n",
-           avg_serial, avg_v1, avg_serial/avg_v1, avg_v2, avg_serial/avg_v2, avg_v3, avg_serial/avg_v3);
-}
-
-int main() {
-    const char *puzzles[] = {
-        "puzzle_easy.txt",
-        "puzzle_medium.txt",
-        "puzzle_escargot.txt",
-        "puzzle_platinum.txt"
+
+    fprintf(f, "puzzle,engine,threads,runs,mean_ns,stddev_ns,ci95_ns,min_ns,median_ns,p90_ns,p99_ns,"
+               "nodes,backtracks,verified,speedup\n");
+    for (int i = 0; i < count; i++) {
+        BenchmarkResult *r = &results[i];
+        fprintf(f, "%s,%s,%d,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%llu,%llu,%d,%.3f\n",
+                r->puzzle, r->engine, r->threads, r->runs,
+                r->mean_ns, r->stddev_ns, r->ci95_ns, r->min_ns, r->median_ns, r->p90_ns, r->p99_ns,
+                r->nodes, r->backtracks, r->verified, r->speedup);
+    }
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static void write_json(const char *filename, BenchmarkResult *results, int count) {
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "[\n");
+    for (int i = 0; i < count; i++) {
+        BenchmarkResult *r = &results[i];
+        fprintf(f, "  {\"puzzle\": \"%s\", \"engine\": \"%s\", \"threads\": %d, \"runs\": %d, "
+                   "\"mean_ns\": %.0f, \"stddev_ns\": %.0f, \"ci95_ns\": %.0f, \"min_ns\": %.0f, "
+                   "\"median_ns\": %.0f, \"p90_ns\": %.0f, \"p99_ns\": %.0f, "
+                   "\"nodes\": %llu, \"backtracks\": %llu, \"verified\": %s, \"speedup\": %.3f}%s\n",
+                r->puzzle, r->engine, r->threads, r->runs,
+                r->mean_ns, r->stddev_ns, r->ci95_ns, r->min_ns, r->median_ns, r->p90_ns, r->p99_ns,
+                r->nodes, r->backtracks, r->verified ? "true" : "false", r->speedup,
+                i + 1 < count ? "," : "");
+    }
+    fprintf(f, "]\n");
+    fclose(f);
+    printf("Results saved to %s\n", filename);
+}
+
+static void print_usage(const char *prog) {
+    printf("Usage: %s [options] [puzzle_file ...]\n", prog);
+    printf("  --threads 1,2,4,8     thread counts to sweep\n");
+    printf("  --engines a,b,...     serial, v1, v2, v3, portfolio, bitboard (default: all)\n");
+    printf("  --warmup N            warm-up solves per configuration (default %d)\n", DEFAULT_WARMUP);
+    printf("  --min-runs N          (default %d)\n", DEFAULT_MIN_RUNS);
+    printf("  --max-runs N          (default %d)\n", DEFAULT_MAX_RUNS);
+    printf("  --ci X                target 95%% CI half-width relative to the mean (default %.2f)\n", DEFAULT_TARGET_CI);
+    printf("  --max-time S          seconds per configuration before giving up on the CI (default %.0f)\n", DEFAULT_MAX_SECONDS);
+    printf("  --csv FILE            (default benchmark_results.csv, corpus_results.csv with --corpus)\n");
+    printf("  --json FILE\n");
+    printf("  --corpus FILE         throughput mode over a one-puzzle-per-line file (repeatable)\n");
+    printf("  --limit N             only the first N puzzles of each corpus\n");
+    printf("  --scaling strong|weak sweep thread counts over the corpora (default %s),\n", DEFAULT_SCALING_CORPUS);
+    printf("                        the first --threads entry is the baseline\n");
+    printf("  --batch N             weak scaling puzzles per thread (default %d)\n", DEFAULT_BATCH);
+    printf("  --time-limit S        per-solve deadline, timed-out solves count as failures\n");
+    printf("  --max-nodes N         per-solve node budget (all threads together)\n");
+    printf("Without puzzle files the four puzzles from 'sudoku_advanced generate' are used.\n");
+}
+
+static int parse_thread_counts(const char *spec, BenchmarkOptions *opt) {
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    opt->num_thread_counts = 0;
+
+    for (char *tok = strtok(buffer, ","); tok; tok = strtok(NULL, ",")) {
+        int t = atoi(tok);
+        if (t < 1 || t > MAX_THREADS || opt->num_thread_counts == MAX_THREAD_COUNTS) return 0;
+        opt->thread_counts[opt->num_thread_counts++] = t;
+    }
+    return opt->num_thread_counts > 0;
+}
+
+static int parse_engines(const char *spec, BenchmarkOptions *opt) {
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    memset(opt->engine_enabled, 0, sizeof(opt->engine_enabled));
+
+    for (char *tok = strtok(buffer, ","); tok; tok = strtok(NULL, ",")) {
+        int found = 0;
+        for (int e = 0; e < NUM_ENGINES; e++) {
+            if (strcmp(tok, solver_engines[e].name) == 0) {
+                opt->engine_enabled[e] = 1;
+                found = 1;
+            }
+        }
+        if (!found) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    static const char *default_puzzles[] = {
+        "puzzles/puzzle_easy.txt",
+        "puzzles/puzzle_medium.txt",
+        "puzzles/puzzle_escargot.txt",
+        "puzzles/puzzle_platinum.txt"
     };
-    const char *names[] = {
-        "Easy",
-        "Medium",
-        "AI Escargot",
-        "Platinum Blonde"
+
+    BenchmarkOptions opt = {
+        .warmup = DEFAULT_WARMUP,
+        .min_runs = DEFAULT_MIN_RUNS,
+        .max_runs = DEFAULT_MAX_RUNS,
+        .target_ci = DEFAULT_TARGET_CI,
+        .max_seconds = DEFAULT_MAX_SECONDS,
+        .thread_counts = { 1, 2, 4, 8 },
+        .num_thread_counts = 4,
+        .batch = DEFAULT_BATCH,
     };
-    
-    FILE *output = fopen("benchmark_results.csv", "w");
-    if (!output) {
-        printf("Error: Cannot create output file\n");
+    for (int e = 0; e < NUM_ENGINES; e++) opt.engine_enabled[e] = 1;
+
+    const char *files[MAX_PUZZLES];
+    int num_files = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int ok = 1;
+
+        if (strcmp(arg, "--help") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else if (arg[0] == '-' && arg[1] == '-') {
+            if (!value) ok = 0;
+            else if (strcmp(arg, "--threads") == 0) ok = parse_thread_counts(value, &opt);
+            else if (strcmp(arg, "--engines") == 0) ok = parse_engines(value, &opt);
+            else if (strcmp(arg, "--warmup") == 0) opt.warmup = atoi(value);
+            else if (strcmp(arg, "--min-runs") == 0) opt.min_runs = atoi(value);
+            else if (strcmp(arg, "--max-runs") == 0) opt.max_runs = atoi(value);
+            else if (strcmp(arg, "--ci") == 0) opt.target_ci = atof(value);
+            else if (strcmp(arg, "--max-time") == 0) opt.max_seconds = atof(value);
+            else if (strcmp(arg, "--csv") == 0) opt.csv_file = value;
+            else if (strcmp(arg, "--json") == 0) opt.json_file = value;
+            else if (strcmp(arg, "--limit") == 0) opt.limit = atoi(value);
+            else if (strcmp(arg, "--time-limit") == 0) opt.limits.time_limit = atof(value);
+            else if (strcmp(arg, "--max-nodes") == 0) opt.limits.max_nodes = strtoull(value, NULL, 10);
+            else if (strcmp(arg, "--batch") == 0) ok = (opt.batch = atoi(value)) > 0;
+            else if (strcmp(arg, "--scaling") == 0) {
+                opt.scaling = value;
+                ok = strcmp(value, "strong") == 0 || strcmp(value, "weak") == 0;
+            }
+            else if (strcmp(arg, "--corpus") == 0 && opt.num_corpora < MAX_CORPORA) {
+                opt.corpora[opt.num_corpora++] = value;
+            }
+            else ok = 0;
+            i++;
+        } else if (num_files < MAX_PUZZLES) {
+            files[num_files++] = arg;
+        }
+
+        if (!ok) {
+            printf("Error: Bad option %s\n", arg);
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (opt.scaling) {
+        if (opt.num_corpora == 0) opt.corpora[opt.num_corpora++] = DEFAULT_SCALING_CORPUS;
+        if (!opt.csv_file) opt.csv_file = "scaling_results.csv";
+        return benchmark_scaling(&opt);
+    }
+    if (opt.num_corpora > 0) {
+        if (!opt.csv_file) opt.csv_file = "corpus_results.csv";
+        return benchmark_corpora(&opt);
+    }
+    if (!opt.csv_file) opt.csv_file = "benchmark_results.csv";
+
+    if (opt.min_runs < 2) opt.min_runs = 2;
+    if (opt.max_runs < opt.min_runs) opt.max_runs = opt.min_runs;
+
+    if (num_files == 0) {
+        num_files = 4;
+        for (int i = 0; i < num_files; i++) files[i] = default_puzzles[i];
+    }
+
+    int max_results = num_files * NUM_ENGINES * opt.num_thread_counts;
+    BenchmarkResult *results = calloc(max_results, sizeof(BenchmarkResult));
+    double *samples = malloc(opt.max_runs * sizeof(double));
+    if (!results || !samples) {
+        printf("Error: Out of memory\n");
         return 1;
     }
-    
-    fprintf(output, "Threads,Puzzle,Serial Time,Parallel V1,Parallel V2,Parallel V3,V1 Speedup,V2 Speedup,V3 Speedup\n");
-    
-    for (int t = 1; t <= 8; t *= 2) {
-        for (int p = 0; p < 4; p++) {
-            run_benchmark(puzzles[p], names[p], t, output);
+    int count = 0;
+
+    printf("%-16s %-10s %3s %6s %12s %12s %12s %12s %10s %8s\n",
+           "Puzzle", "Engine", "Thr", "Runs", "Median(us)", "P90(us)", "P99(us)", "Stddev(us)", "CI95(%)", "Speedup");
+
+    for (int p = 0; p < num_files; p++) {
+        SudokuGrid puzzle;
+        load_puzzle(files[p], &puzzle);
+        char name[64];
+        puzzle_name(files[p], name, sizeof(name));
+        double serial_median = 0;
+
+        for (int e = 0; e < NUM_ENGINES; e++) {
+            if (!opt.engine_enabled[e]) continue;
+
+            for (int t = 0; t < opt.num_thread_counts; t++) {
+                int threads = opt.thread_counts[t];
+                if (!solver_engines[e].parallel && t > 0) break;
+                if (!solver_engines[e].parallel) threads = 1;
+
+                BenchmarkResult *r = &results[count++];
+                snprintf(r->puzzle, sizeof(r->puzzle), "%s", name);
+                run_benchmark(&puzzle, &solver_engines[e], threads, &opt, samples, r);
+
+                // Only the serial engine is the baseline (bitboard is single threaded too)
+                if (strcmp(solver_engines[e].name, "serial") == 0) serial_median = r->median_ns;
+                r->speedup = serial_median > 0 ? serial_median / r->median_ns : 0;
+
+                printf("%-16s %-10s %3d %6d %12.2f %12.2f %12.2f %12.2f %10.2f %7.2fx%s\n",
+                       r->puzzle, r->engine, r->threads, r->runs,
+                       r->median_ns / 1000, r->p90_ns / 1000, r->p99_ns / 1000, r->stddev_ns / 1000,
+                       100.0 * r->ci95_ns / r->mean_ns, r->speedup,
+                       r->verified ? "" : "  (NOT VERIFIED)");
+            }
         }
     }
-    
-    fclose(output);
-    printf("Benchmark complete! Results saved to benchmark_results.csv\n");
-    
+
+    if (opt.csv_file) write_csv(opt.csv_file, results, count);
+    if (opt.json_file) write_json(opt.json_file, results, count);
+
+    free(samples);
+    free(results);
     return 0;
 }
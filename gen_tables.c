@@ -0,0 +1,199 @@
+// Generates sudoku_tables.h - the cell/unit/peer lookup tables the solver
+// uses instead of recomputing (row/3)*3 style coordinates in the hot loops,
+// plus the band tables of the bitboard engine (sudoku_bitboard.c) and the
+// Zobrist keys for hashing grids.
+// Run `make tables` after changing anything here.
+
+#include <stdio.h>
+
+#define N 9
+#define NUM_CELLS (N * N)
+#define NUM_UNITS (3 * N)
+#define NUM_PEERS 20
+
+#define BAND_CELLS 27  // 3 rows of 9, bit = row_in_band * 9 + col
+
+// A 9-bit "minirow" mask has bit r*3+x set when row r of a band still has the
+// digit somewhere in box x of the band. The digit has to end up in exactly
+// one minirow per row and per box, i.e. a permutation r -> x. Returns the
+// union of the permutations that fit inside mask (0 = none fits).
+static int band_permutations(int mask) {
+    static const int perms[6][3] = {
+        { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 }
+    };
+    int allowed = 0;
+    for (int p = 0; p < 6; p++) {
+        int bits = 0;
+        for (int r = 0; r < 3; r++) bits |= 1 << (r * 3 + perms[p][r]);
+        if ((bits & mask) == bits) allowed |= bits;
+    }
+    return allowed;
+}
+
+// Fixed seed, so regenerating the header gives the same keys
+static unsigned long long splitmix64(unsigned long long *state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void print_row(FILE *f, const int *values, int count) {
+    fprintf(f, "{");
+    for (int i = 0; i < count; i++) {
+        fprintf(f, "%s%2d", i ? ", " : " ", values[i]);
+    }
+    fprintf(f, " }");
+}
+
+// 81 entries, one board row per line
+static void print_cell_table(FILE *f, const char *name, const int *values) {
+    fprintf(f, "static const unsigned char %s[NUM_CELLS] = {\n", name);
+    for (int r = 0; r < N; r++) {
+        fprintf(f, "   ");
+        for (int c = 0; c < N; c++) {
+            fprintf(f, " %d,", values[r * N + c]);
+        }
+        fprintf(f, "\n");
+    }
+    fprintf(f, "};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+    const char *filename = argc >= 2 ? argv[1] : "sudoku_tables.h";
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Could not create %s\n", filename);
+        return 1;
+    }
+    
+    int row[NUM_CELLS], col[NUM_CELLS], box[NUM_CELLS];
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        row[cell] = cell / N;
+        col[cell] = cell % N;
+        box[cell] = (row[cell] / 3) * 3 + col[cell] / 3;
+    }
+    
+    // Units 0-8 are rows, 9-17 columns, 18-26 boxes
+    int units[NUM_UNITS][N];
+    int fill[NUM_UNITS] = {0};
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        units[row[cell]][fill[row[cell]]++] = cell;
+        units[N + col[cell]][fill[N + col[cell]]++] = cell;
+        units[2 * N + box[cell]][fill[2 * N + box[cell]]++] = cell;
+    }
+    
+    fprintf(f, "// Generated by gen_tables.c - do not edit, run `make tables` instead\n\n");
+    fprintf(f, "#ifndef SUDOKU_TABLES_H\n#define SUDOKU_TABLES_H\n\n");
+    fprintf(f, "#define NUM_CELLS %d\n#define NUM_UNITS %d\n#define NUM_PEERS %d\n\n",
+            NUM_CELLS, NUM_UNITS, NUM_PEERS);
+    fprintf(f, "#define ROW_UNIT(r) (r)\n#define COL_UNIT(c) (%d + (c))\n#define BOX_UNIT(b) (%d + (b))\n\n",
+            N, 2 * N);
+    
+    print_cell_table(f, "cell_row", row);
+    print_cell_table(f, "cell_col", col);
+    print_cell_table(f, "cell_box", box);
+    
+    fprintf(f, "// Cells of each unit, in row-major order\n");
+    fprintf(f, "static const unsigned char unit_cells[NUM_UNITS][%d] = {\n", N);
+    for (int u = 0; u < NUM_UNITS; u++) {
+        fprintf(f, "    ");
+        print_row(f, units[u], N);
+        fprintf(f, ",\n");
+    }
+    fprintf(f, "};\n\n");
+    
+    fprintf(f, "// Row, column and box unit of each cell\n");
+    fprintf(f, "static const unsigned char cell_units[NUM_CELLS][3] = {\n");
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        int u[3] = { row[cell], N + col[cell], 2 * N + box[cell] };
+        fprintf(f, "    ");
+        print_row(f, u, 3);
+        fprintf(f, ",\n");
+    }
+    fprintf(f, "};\n\n");
+    
+    fprintf(f, "// The 20 other cells sharing a row, column or box with each cell\n");
+    fprintf(f, "static const unsigned char cell_peers[NUM_CELLS][NUM_PEERS] = {\n");
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        int peers[NUM_PEERS], count = 0;
+        for (int other = 0; other < NUM_CELLS; other++) {
+            if (other != cell && (row[other] == row[cell] || col[other] == col[cell] ||
+                                  box[other] == box[cell])) {
+                peers[count++] = other;
+            }
+        }
+        if (count != NUM_PEERS) {
+            printf("Error: cell %d has %d peers\n", cell, count);
+            fclose(f);
+            return 1;
+        }
+        fprintf(f, "    ");
+        print_row(f, peers, NUM_PEERS);
+        fprintf(f, ",\n");
+    }
+    fprintf(f, "};\n\n");
+    
+    // ---- Bitboard engine: one 27-bit word per digit per band ----
+    
+    fprintf(f, "#define BAND_CELLS %d\n#define BAND_MASK 0x%07X\n\n", BAND_CELLS, (1 << BAND_CELLS) - 1);
+    
+    fprintf(f, "// Peers of each cell as a bit mask per band (the cell itself not included)\n");
+    fprintf(f, "static const unsigned int band_peers[NUM_CELLS][3] = {\n");
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        unsigned int masks[3] = { 0, 0, 0 };
+        for (int other = 0; other < NUM_CELLS; other++) {
+            if (other != cell && (row[other] == row[cell] || col[other] == col[cell] ||
+                                  box[other] == box[cell])) {
+                masks[other / BAND_CELLS] |= 1u << (other % BAND_CELLS);
+            }
+        }
+        fprintf(f, "    { 0x%07X, 0x%07X, 0x%07X },\n", masks[0], masks[1], masks[2]);
+    }
+    fprintf(f, "};\n\n");
+    
+    fprintf(f, "// 9 bits of a row -> which of its 3 boxes are non-empty\n");
+    fprintf(f, "static const unsigned char row_boxes[512] = {");
+    for (int m = 0; m < 512; m++) {
+        int boxes = ((m & 0007) ? 1 : 0) | ((m & 0070) ? 2 : 0) | ((m & 0700) ? 4 : 0);
+        fprintf(f, "%s%d,", m % 32 ? " " : "\n    ", boxes);
+    }
+    fprintf(f, "\n};\n\n");
+    
+    fprintf(f, "// Minirow mask -> minirows some row/box permutation can still use, 0 = dead end.\n");
+    fprintf(f, "// The same table works for columns x bands inside a stack.\n");
+    fprintf(f, "static const unsigned short band_locked[512] = {");
+    for (int m = 0; m < 512; m++) {
+        fprintf(f, "%s0x%03X,", m % 16 ? " " : "\n    ", band_permutations(m));
+    }
+    fprintf(f, "\n};\n\n");
+    
+    fprintf(f, "// Minirow mask -> the band cells it covers\n");
+    fprintf(f, "static const unsigned int minirow_cells[512] = {");
+    for (int m = 0; m < 512; m++) {
+        unsigned int cells = 0;
+        for (int bit = 0; bit < 9; bit++) {
+            if (m & (1 << bit)) cells |= 7u << ((bit / 3) * 9 + (bit % 3) * 3);
+        }
+        fprintf(f, "%s0x%07X,", m % 8 ? " " : "\n    ", cells);
+    }
+    fprintf(f, "\n};\n\n");
+    
+    // ---- Zobrist keys: a grid's hash is the XOR over its filled cells ----
+    
+    fprintf(f, "// Random key per cell and value; value 0 (empty) is 0 so it drops out of the XOR\n");
+    fprintf(f, "static const unsigned long long zobrist[NUM_CELLS][%d] = {\n", N + 1);
+    unsigned long long state = 0x5D0C0DE5EEDULL;
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        fprintf(f, "    { 0x0ULL");
+        for (int value = 1; value <= N; value++) {
+            fprintf(f, ",%s0x%016llXULL", value % 3 ? " " : "\n      ", splitmix64(&state));
+        }
+        fprintf(f, " },\n");
+    }
+    fprintf(f, "};\n\n#endif\n");
+    
+    fclose(f);
+    printf("Generated %s\n", filename);
+    return 0;
+}
@@ -18,16 +18,16 @@ set OMP_NUM_THREADS=1
 echo === 1 THREAD === > results\test_results.txt
 echo. >> results\test_results.txt
 echo Easy Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_easy.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_easy.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Medium Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_medium.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_medium.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo AI Escargot: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_escargot.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_escargot.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Platinum Blonde: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_platinum.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_platinum.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo.
 
@@ -37,16 +37,16 @@ set OMP_NUM_THREADS=2
 echo === 2 THREADS === >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Easy Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_easy.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_easy.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Medium Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_medium.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_medium.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo AI Escargot: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_escargot.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_escargot.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Platinum Blonde: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_platinum.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_platinum.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo.
 
@@ -56,16 +56,16 @@ set OMP_NUM_THREADS=4
 echo === 4 THREADS === >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Easy Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_easy.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_easy.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Medium Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_medium.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_medium.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo AI Escargot: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_escargot.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_escargot.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Platinum Blonde: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_platinum.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_platinum.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo.
 
@@ -75,16 +75,16 @@ set OMP_NUM_THREADS=8
 echo === 8 THREADS === >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Easy Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_easy.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_easy.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Medium Puzzle: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_medium.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_medium.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo AI Escargot: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_escargot.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_escargot.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo Platinum Blonde: >> results\test_results.txt
-bin\sudoku_advanced.exe puzzles\puzzle_platinum.txt >> results\test_results.txt
+bin\sudoku_advanced.exe benchmark puzzles\puzzle_platinum.txt >> results\test_results.txt
 echo. >> results\test_results.txt
 echo.
 
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# Plots the scaling study from `make scaling`
+# Top row: efficiency vs threads, bottom row: where the thread time went
+
+import os
+import pandas as pd
+import matplotlib.pyplot as plt
+
+PARTS = ['useful_s', 'redundant_s', 'sync_s', 'idle_s']
+LABELS = ['Useful search', 'Redundant search', 'Sync', 'Idle']
+COLORS = ['tab:green', 'tab:orange', 'tab:red', 'lightgray']
+
+modes = [m for m in ['strong', 'weak'] if os.path.exists(f'results/scaling_{m}.csv')]
+if not modes:
+    print("No results/scaling_*.csv found - run 'make scaling' first")
+    raise SystemExit(1)
+
+fig, axes = plt.subplots(2, len(modes), figsize=(7 * len(modes), 10), squeeze=False)
+fig.suptitle('Sudoku Solver Scaling', fontsize=16, fontweight='bold')
+
+for col, mode in enumerate(modes):
+    df = pd.read_csv(f'results/scaling_{mode}.csv')
+    df = df[df['engine'] != 'serial']  # one point, nothing to scale
+
+    # Efficiency per engine
+    ax = axes[0, col]
+    for engine in df['engine'].unique():
+        data = df[df['engine'] == engine]
+        ax.plot(data['threads'], data['efficiency'] * 100, marker='o', label=engine, linewidth=2)
+    ax.axhline(100, color='black', linestyle='--', alpha=0.5)
+    ax.set_xlabel('Thread Count')
+    ax.set_ylabel('Parallel Efficiency (%)')
+    ax.set_title(f'{mode.capitalize()} Scaling Efficiency')
+    ax.legend()
+    ax.grid(True, alpha=0.3)
+
+    # Stacked breakdown as a share of threads * wall time
+    ax = axes[1, col]
+    thread_s = df['threads'] * df['wall_s']
+    names = [f"{e}\n{t}T" for e, t in zip(df['engine'], df['threads'])]
+    bottom = [0.0] * len(df)
+    for part, label, color in zip(PARTS, LABELS, COLORS):
+        share = (df[part] / thread_s * 100).tolist()
+        ax.bar(names, share, bottom=bottom, label=label, color=color)
+        bottom = [b + s for b, s in zip(bottom, share)]
+    ax.set_ylabel('Share of Thread Time (%)')
+    ax.set_title(f'{mode.capitalize()} Scaling Time Breakdown')
+    ax.tick_params(axis='x', rotation=90)
+    ax.legend()
+
+    print(f"\n{mode.capitalize()} scaling:")
+    print(df[['engine', 'threads', 'puzzles', 'wall_s', 'speedup', 'efficiency']].to_string(index=False))
+
+plt.tight_layout()
+plt.savefig('results/scaling_graphs.png', dpi=300, bbox_inches='tight')
+print("\n✓ Graphs saved to: results/scaling_graphs.png")
+plt.show()
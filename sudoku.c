@@ -6,127 +6,216 @@
 
 #define N 9
 #define UNASSIGNED 0
+#define ALL_DIGITS 0x1FF
+
+// Grid plus which digits each row, column and box already holds (bit d-1 =
+// digit d), kept up to date on every place/clear so checking a digit is one
+// OR of three masks instead of scanning 27 cells
+typedef struct {
+    int grid[N][N];
+    unsigned short row_used[N];
+    unsigned short col_used[N];
+    unsigned short box_used[N];
+} Board;
+
+#define BOX(row, col) (((row) / 3) * 3 + (col) / 3)
 
 // Function prototypes
 int solve_serial(int grid[N][N]);
 int solve_parallel_v1(int grid[N][N]);
 int solve_parallel_v2(int grid[N][N]);
-int is_valid(int grid[N][N], int row, int col, int num);
-int find_empty_location(int grid[N][N], int *row, int *col);
+int solve_board(Board *board, volatile int *stop, volatile int *outer);
+int load_board(Board *board, int grid[N][N]);
+int is_valid(const Board *board, int row, int col, int num);
+int find_best_location(const Board *board, int *row, int *col, unsigned short *free_digits);
 void print_grid(int grid[N][N]);
 void copy_grid(int src[N][N], int dst[N][N]);
 int verify_solution(int grid[N][N]);
 void load_puzzle(const char *filename, int grid[N][N]);
 void generate_test_puzzles();
 
-// Serial backtracking solver
-int solve_serial(int grid[N][N]) {
+static inline unsigned short free_digits_at(const Board *board, int row, int col) {
+    return ALL_DIGITS & ~(board->row_used[row] | board->col_used[col] | board->box_used[BOX(row, col)]);
+}
+
+static inline void place(Board *board, int row, int col, int num) {
+    unsigned short bit = 1 << (num - 1);
+    board->grid[row][col] = num;
+    board->row_used[row] |= bit;
+    board->col_used[col] |= bit;
+    board->box_used[BOX(row, col)] |= bit;
+}
+
+static inline void clear(Board *board, int row, int col, int num) {
+    unsigned short bit = 1 << (num - 1);
+    board->grid[row][col] = UNASSIGNED;
+    board->row_used[row] &= ~bit;
+    board->col_used[col] &= ~bit;
+    board->box_used[BOX(row, col)] &= ~bit;
+}
+
+// Build the masks from a grid. Returns 0 if the givens already clash.
+int load_board(Board *board, int grid[N][N]) {
+    memset(board, 0, sizeof(Board));
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int num = grid[i][j];
+            if (num == UNASSIGNED) continue;
+            if (!is_valid(board, i, j, num)) return 0;
+            place(board, i, j, num);
+        }
+    }
+    return 1;
+}
+
+// Check if num can go to (row, col) - O(1)
+int is_valid(const Board *board, int row, int col, int num) {
+    return (free_digits_at(board, row, col) >> (num - 1)) & 1;
+}
+
+// MRV: the empty cell with the fewest digits left, stops early on 0 or 1.
+// Returns 0 when the grid is full.
+int find_best_location(const Board *board, int *row, int *col, unsigned short *free_digits) {
+    int best = N + 1;
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            if (board->grid[i][j] != UNASSIGNED) continue;
+            
+            unsigned short digits = free_digits_at(board, i, j);
+            int count = __builtin_popcount(digits);
+            if (count < best) {
+                best = count;
+                *row = i;
+                *col = j;
+                *free_digits = digits;
+                if (count <= 1) return 1;
+            }
+        }
+    }
+    return best <= N;
+}
+
+// The backtracking core every version runs. stop lets a parallel caller
+// call off the search once another thread has the solution, outer does the
+// same for the branch that caller is itself nested in.
+int solve_board(Board *board, volatile int *stop, volatile int *outer) {
     int row, col;
+    unsigned short digits;
     
-    if (!find_empty_location(grid, &row, &col))
+    if (!find_best_location(board, &row, &col, &digits))
         return 1; // Success - puzzle solved
+    if ((stop && *stop) || (outer && *outer))
+        return 0;
     
-    for (int num = 1; num <= 9; num++) {
-        if (is_valid(grid, row, col, num)) {
-            grid[row][col] = num;
-            
-            if (solve_serial(grid))
-                return 1;
-            
-            grid[row][col] = UNASSIGNED; // Backtrack
-        }
+    while (digits) {
+        int num = __builtin_ctz(digits) + 1;
+        digits &= digits - 1;
+        
+        place(board, row, col, num);
+        if (solve_board(board, stop, outer))
+            return 1;
+        clear(board, row, col, num); // Backtrack
     }
     
     return 0; // Trigger backtracking
 }
 
+// Serial backtracking solver
+int solve_serial(int grid[N][N]) {
+    Board board;
+    if (!load_board(&board, grid) || !solve_board(&board, NULL, NULL))
+        return 0;
+    copy_grid(board.grid, grid);
+    return 1;
+}
+
 // Parallel Version 1: Using OpenMP tasks for recursive branching
-int solve_parallel_v1_helper(int grid[N][N], int depth) {
+int solve_parallel_v1_helper(Board *board, int depth, volatile int *stop, volatile int *outer) {
     int row, col;
+    unsigned short digits;
     
-    if (!find_empty_location(grid, &row, &col))
+    if (!find_best_location(board, &row, &col, &digits))
         return 1; // Success
     
+    // Use serial solving below the task levels (and for forced cells)
+    if (depth >= 2 || digits == 0 || (digits & (digits - 1)) == 0)
+        return solve_board(board, stop, outer);
+    
     int solved = 0;
+    Board solution;
     
     // Create tasks for different numbers at shallow depth
-    if (depth < 2) { // Limit task creation depth
-        #pragma omp parallel
+    #pragma omp parallel
+    {
+        #pragma omp single
         {
-            #pragma omp single
-            {
-                for (int num = 1; num <= 9 && !solved; num++) {
-                    if (is_valid(grid, row, col, num)) {
-                        #pragma omp task shared(solved) firstprivate(num, row, col)
-                        {
-                            if (!solved) {
-                                int local_grid[N][N];
-                                #pragma omp critical
-                                copy_grid(grid, local_grid);
-                                
-                                local_grid[row][col] = num;
-                                
-                                if (solve_parallel_v1_helper(local_grid, depth + 1)) {
-                                    #pragma omp critical
-                                    {
-                                        if (!solved) {
-                                            copy_grid(local_grid, grid);
-                                            solved = 1;
-                                        }
-                                    }
+            for (unsigned short left = digits; left && !solved; left &= left - 1) {
+                int num = __builtin_ctz(left) + 1;
+                
+                #pragma omp task shared(solved, solution) firstprivate(num)
+                {
+                    if (!solved && !(stop && *stop) && !(outer && *outer)) {
+                        Board local = *board;  // the parent isn't touched while tasks run
+                        place(&local, row, col, num);
+                        
+                        // Tasks only go two levels deep, so our flag and
+                        // our caller's are all a nested search has to watch
+                        if (solve_parallel_v1_helper(&local, depth + 1, &solved, stop)) {
+                            #pragma omp critical
+                            {
+                                if (!solved) {
+                                    solution = local;
+                                    solved = 1;
                                 }
                             }
                         }
                     }
                 }
-                #pragma omp taskwait
-            }
-        }
-    } else {
-        // Use serial solving for deeper levels
-        for (int num = 1; num <= 9; num++) {
-            if (is_valid(grid, row, col, num)) {
-                grid[row][col] = num;
-                
-                if (solve_serial(grid))
-                    return 1;
-                
-                grid[row][col] = UNASSIGNED;
             }
+            #pragma omp taskwait
         }
     }
     
+    if (solved)
+        *board = solution;
     return solved;
 }
 
 int solve_parallel_v1(int grid[N][N]) {
-    return solve_parallel_v1_helper(grid, 0);
+    Board board;
+    if (!load_board(&board, grid) || !solve_parallel_v1_helper(&board, 0, NULL, NULL))
+        return 0;
+    copy_grid(board.grid, grid);
+    return 1;
 }
 
 // Parallel Version 2: Using OpenMP parallel for with speculation
 int solve_parallel_v2(int grid[N][N]) {
+    Board board;
     int row, col;
+    unsigned short digits;
     
-    if (!find_empty_location(grid, &row, &col))
+    if (!load_board(&board, grid))
+        return 0;
+    if (!find_best_location(&board, &row, &col, &digits))
         return 1; // Already solved
     
     int solved = 0;
-    int solution_grid[N][N];
+    Board solution;
     
-    #pragma omp parallel shared(solved, solution_grid)
+    #pragma omp parallel shared(solved, solution)
     {
         #pragma omp for schedule(dynamic)
         for (int num = 1; num <= 9; num++) {
-            if (!solved && is_valid(grid, row, col, num)) {
-                int local_grid[N][N];
-                copy_grid(grid, local_grid);
-                local_grid[row][col] = num;
+            if (!solved && ((digits >> (num - 1)) & 1)) {
+                Board local = board;
+                place(&local, row, col, num);
                 
-                if (solve_serial(local_grid)) {
+                if (solve_board(&local, &solved, NULL)) {
                     #pragma omp critical
                     {
                         if (!solved) {
-                            copy_grid(local_grid, solution_grid);
+                            solution = local;
                             solved = 1;
                         }
                     }
@@ -136,45 +225,13 @@ int solve_parallel_v2(int grid[N][N]) {
     }
     
     if (solved) {
-        copy_grid(solution_grid, grid);
+        copy_grid(solution.grid, grid);
         return 1;
     }
     
     return 0;
 }
 
-// Check if num is valid at grid[row][col]
-int is_valid(int grid[N][N], int row, int col, int num) {
-    // Check row
-    for (int x = 0; x < N; x++)
-        if (grid[row][x] == num)
-            return 0;
-    
-    // Check column
-    for (int x = 0; x < N; x++)
-        if (grid[x][col] == num)
-            return 0;
-    
-    // Check 3x3 box
-    int start_row = row - row % 3;
-    int start_col = col - col % 3;
-    for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++)
-            if (grid[i + start_row][j + start_col] == num)
-                return 0;
-    
-    return 1;
-}
-
-// Find an empty location in the grid
-int find_empty_location(int grid[N][N], int *row, int *col) {
-    for (*row = 0; *row < N; (*row)++)
-        for (*col = 0; *col < N; (*col)++)
-            if (grid[*row][*col] == UNASSIGNED)
-                return 1;
-    return 0;
-}
-
 // Print the grid
 void print_grid(int grid[N][N]) {
     for (int row = 0; row < N; row++) {
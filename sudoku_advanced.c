@@ -8,73 +8,109 @@
 #include <omp.h>
 #include <math.h>
 
-#define N 9
-#define UNASSIGNED 0
-#define MAX_THREADS 16
+#ifdef SUDOKU_PROFILE
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if defined(SUDOKU_TRACE) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+#include "sudoku_advanced.h"
+
+// Cell/unit/peer lookup tables (cells are numbered row * N + col)
+#include "sudoku_tables.h"
+
+// Hardware counter profiling - build with -DSUDOKU_PROFILE (Linux only).
+// Sections are timed with perf_event_open counters per thread; in a normal
+// build the macros compile to nothing.
+#ifdef SUDOKU_PROFILE
+typedef enum {
+    PROF_NAKED_SINGLES,
+    PROF_HIDDEN_SINGLES,
+    PROF_SUBSETS,
+    PROF_POINTING_PAIRS,
+    PROF_XWING,
+    PROF_SWORDFISH,
+    PROF_XY_WING,
+    PROF_BRANCHING,
+    PROF_GRID_COPY,
+    PROF_SECTIONS
+} ProfileSection;
+
+enum { PROF_NS, PROF_CYCLES, PROF_INSTRUCTIONS, PROF_CACHE_MISSES, PROF_BRANCH_MISSES, PROF_COUNTERS };
 
-// Stats tracking - keeps count of backtracks, techniques used, etc.
 typedef struct {
-    unsigned long long backtrack_count;
-    unsigned long long naked_singles_found;
-    unsigned long long hidden_singles_found;
-    unsigned long long naked_pairs_found;
-    unsigned long long pointing_pairs_found;
-    unsigned long long box_line_reductions;
-    unsigned long long nodes_explored;
-    double time_taken;
-    int thread_id;
-} SolverStats;
-
-// Using bitsets for candidate tracking - more efficient than arrays
-typedef unsigned short CandidateSet;
-
-// Main grid structure
+    unsigned long long value[PROF_COUNTERS];
+} ProfileSample;
+
 typedef struct {
-    int cells[N][N];
-    CandidateSet candidates[N][N];  // possible values for each cell
-    int empty_cells;
-} SudokuGrid;
-
-// Function declarations
-int solve_serial(SudokuGrid *grid, SolverStats *stats);
-int solve_parallel_v1(SudokuGrid *grid, SolverStats *stats);
-int solve_parallel_v2(SudokuGrid *grid, SolverStats *stats);
-int solve_parallel_v3(SudokuGrid *grid, SolverStats *stats);
-
-void init_grid(SudokuGrid *grid);
-void copy_grid(SudokuGrid *src, SudokuGrid *dst);
-int verify_solution(SudokuGrid *grid);
-void load_puzzle(const char *filename, SudokuGrid *grid);
-void print_grid(SudokuGrid *grid);
-void print_stats(SolverStats *stats, const char *version);
-void aggregate_stats(SolverStats *stats_array, int count, SolverStats *result);
-
-// Advanced solving techniques
-int apply_naked_singles(SudokuGrid *grid, SolverStats *stats);
-int apply_hidden_singles(SudokuGrid *grid, SolverStats *stats);
-int apply_naked_pairs(SudokuGrid *grid, SolverStats *stats);
-int apply_pointing_pairs(SudokuGrid *grid, SolverStats *stats);
-int apply_box_line_reduction(SudokuGrid *grid, SolverStats *stats);
-int apply_constraint_propagation(SudokuGrid *grid, SolverStats *stats);
-
-// Candidate management
-void init_candidates(SudokuGrid *grid);
-void update_candidates(SudokuGrid *grid, int row, int col, int num);
-int count_candidates(CandidateSet cand);
-int get_candidate(CandidateSet cand, int index);
-CandidateSet make_candidate_set(int *values, int count);
-
-// Heuristics
-int find_best_cell(SudokuGrid *grid, int *row, int *col);
-double estimate_difficulty(SudokuGrid *grid);
-
-// Puzzle generation
-void generate_puzzle(SudokuGrid *grid, int difficulty);
-void generate_test_suite();
-
-// Visualization
-void print_candidates(SudokuGrid *grid);
-void export_solving_trace(const char *filename, SudokuGrid *grid);
+    unsigned long long calls[PROF_SECTIONS];
+    unsigned long long total[PROF_SECTIONS][PROF_COUNTERS];
+} ThreadProfile;
+
+void profile_reset(void);
+void profile_read(ProfileSample *sample);
+void profile_record(ProfileSection section, ProfileSample *start);
+void print_profile(void);
+
+#define PROFILE_START(sample) ProfileSample sample; profile_read(&sample)
+#define PROFILE_STOP(sample, section) profile_record(section, &sample)
+#define PROFILE_RESET() profile_reset()
+#else
+#define PROFILE_START(sample)
+#define PROFILE_STOP(sample, section)
+#define PROFILE_RESET()
+#endif
+
+// Search event trace - build with -DSUDOKU_TRACE. Every thread appends
+// 16-byte events to its own ring buffer (no locks, no atomics), the oldest
+// events get overwritten when it wraps. export_solving_trace() dumps the
+// last solve and trace_to_chrome.py turns that into Chrome/Perfetto JSON.
+#ifdef SUDOKU_TRACE
+typedef enum {
+    TRACE_SEARCH_BEGIN,  // solve_iterative() entered, arg = 0
+    TRACE_SEARCH_END,    // solve_iterative() returned, arg = result (0xFFFFFFFF = over budget)
+    TRACE_NODE,          // node entered, arg = depth
+    TRACE_TECHNIQUE,     // technique made progress, arg = TraceTechnique
+    TRACE_BRANCH,        // child taken, arg = cell * 16 + value
+    TRACE_BACKTRACK,     // popped exhausted nodes, arg = new depth
+    TRACE_STEAL,         // work taken from another thread, arg = victim thread (V1) or depth (hybrid)
+    TRACE_CANCEL         // stopped because another thread won, arg = depth
+} TraceEventType;
+
+typedef enum {
+    TECH_NAKED_SINGLES, TECH_HIDDEN_SINGLES, TECH_SUBSETS, TECH_POINTING_PAIRS,
+    TECH_XWING, TECH_SWORDFISH, TECH_XY_WING
+} TraceTechnique;
+
+void trace_reset(void);
+void trace_event(int type, unsigned int arg);
+
+#define TRACE_EVENT(type, arg) trace_event(type, arg)
+#define TRACE_RESET() trace_reset()
+#else
+#define TRACE_EVENT(type, arg) ((void)0)
+#define TRACE_RESET() ((void)0)
+#endif
+
+// The Zobrist hash in SudokuGrid is kept up to date by update_candidates(),
+// one XOR per placement. -DSUDOKU_NO_GRID_HASH drops that (make hashcost
+// compares the two) and the transposition table hashes all 81 cells instead.
+#ifdef SUDOKU_NO_GRID_HASH
+#define GRID_HASH_PLACE(grid, cell, num) ((void)0)
+#define GRID_KEY(grid) grid_hash(grid)
+#else
+#define GRID_HASH_PLACE(grid, cell, num) ((grid)->hash ^= zobrist[cell][num])
+#define GRID_KEY(grid) ((grid)->hash)
+#endif
+
+// Heuristics used by every engine unless a caller passes its own config
+SearchConfig search_config = { .cell_order = CELL_MRV, .value_order = VALUE_ASCENDING, .seed = 1,
+                               .propagation = PROPAGATE_ALL, .subset_size = 2 };
 
 // ========== Candidate Set Operations ==========
 
@@ -118,21 +154,28 @@ void init_grid(SudokuGrid *grid) {
         }
     }
     grid->empty_cells = N * N;
+    grid->hash = 0;
 }
 
 // Copy one grid to another - needed for parallel branches
 void copy_grid(SudokuGrid *src, SudokuGrid *dst) {
+    PROFILE_START(prof);
     memcpy(dst->cells, src->cells, sizeof(src->cells));
     memcpy(dst->candidates, src->candidates, sizeof(src->candidates));
     dst->empty_cells = src->empty_cells;
+    dst->hash = src->hash;
+    PROFILE_STOP(prof, PROF_GRID_COPY);
 }
 
 void init_candidates(SudokuGrid *grid) {
     // First pass - mark all empty cells with all possibilities
+    grid->empty_cells = 0;
+    grid->hash = 0;  // the second pass adds the placed cells back
     for (int i = 0; i < N; i++) {
         for (int j = 0; j < N; j++) {
             if (grid->cells[i][j] == UNASSIGNED) {
                 grid->candidates[i][j] = 0x1FF;  // all numbers possible
+                grid->empty_cells++;
             } else {
                 grid->candidates[i][j] = 0;  // already filled
             }
@@ -150,33 +193,24 @@ void init_candidates(SudokuGrid *grid) {
 }
 
 void update_candidates(SudokuGrid *grid, int row, int col, int num) {
-    unsigned short mask = ~(1 << (num - 1));
-    
-    // Remove from row
-    for (int j = 0; j < N; j++) {
-        grid->candidates[row][j] &= mask;
-    }
-    
-    // Remove from column
-    for (int i = 0; i < N; i++) {
-        grid->candidates[i][col] &= mask;
-    }
-    
-    // Remove from box
-    int box_row = (row / 3) * 3;
-    int box_col = (col / 3) * 3;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            grid->candidates[box_row + i][box_col + j] &= mask;
-        }
+    CandidateSet mask = ~(1 << (num - 1));
+    CandidateSet *cand = &grid->candidates[0][0];
+    int cell = row * N + col;
+    
+    // Remove from the row, column and box in one pass over the peer list
+    const unsigned char *peers = cell_peers[cell];
+    for (int k = 0; k < NUM_PEERS; k++) {
+        cand[peers[k]] &= mask;
     }
     
-    grid->candidates[row][col] = 0;
+    cand[cell] = 0;
+    GRID_HASH_PLACE(grid, cell, num);
 }
 
 // ========== Advanced Solving Techniques ==========
 
 int apply_naked_singles(SudokuGrid *grid, SolverStats *stats) {
+    PROFILE_START(prof);
     int progress = 0;
     for (int i = 0; i < N; i++) {
         for (int j = 0; j < N; j++) {
@@ -190,26 +224,33 @@ int apply_naked_singles(SudokuGrid *grid, SolverStats *stats) {
             }
         }
     }
+    PROFILE_STOP(prof, PROF_NAKED_SINGLES);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, TECH_NAKED_SINGLES);
     return progress;
 }
 
 int apply_hidden_singles(SudokuGrid *grid, SolverStats *stats) {
+    PROFILE_START(prof);
     int progress = 0;
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
     
-    // Check rows
-    for (int i = 0; i < N; i++) {
+    // Rows, then columns, then boxes
+    for (int u = 0; u < NUM_UNITS; u++) {
+        const unsigned char *unit = unit_cells[u];
+        
         for (int num = 1; num <= 9; num++) {
-            int count = 0, last_col = -1;
-            for (int j = 0; j < N; j++) {
-                if (grid->cells[i][j] == UNASSIGNED && 
-                    (grid->candidates[i][j] & (1 << (num - 1)))) {
+            CandidateSet bit = 1 << (num - 1);
+            int count = 0, last = -1;
+            for (int k = 0; k < N; k++) {
+                if (cells[unit[k]] == UNASSIGNED && (cand[unit[k]] & bit)) {
                     count++;
-                    last_col = j;
+                    last = unit[k];
                 }
             }
             if (count == 1) {
-                grid->cells[i][last_col] = num;
-                update_candidates(grid, i, last_col, num);
+                cells[last] = num;
+                update_candidates(grid, cell_row[last], cell_col[last], num);
                 grid->empty_cells--;
                 stats->hidden_singles_found++;
                 progress = 1;
@@ -217,160 +258,325 @@ int apply_hidden_singles(SudokuGrid *grid, SolverStats *stats) {
         }
     }
     
-    // Check columns
-    for (int j = 0; j < N; j++) {
-        for (int num = 1; num <= 9; num++) {
-            int count = 0, last_row = -1;
-            for (int i = 0; i < N; i++) {
-                if (grid->cells[i][j] == UNASSIGNED && 
-                    (grid->candidates[i][j] & (1 << (num - 1)))) {
-                    count++;
-                    last_row = i;
+    PROFILE_STOP(prof, PROF_HIDDEN_SINGLES);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, TECH_HIDDEN_SINGLES);
+    return progress;
+}
+
+// Next larger mask with the same number of bits set (Gosper's hack)
+static inline unsigned int next_subset(unsigned int x) {
+    unsigned int low = x & -x;
+    unsigned int ripple = x + low;
+    return ripple | (((x ^ ripple) >> 2) / low);
+}
+
+// Union of the option masks picked by subset (bit i = opts[i])
+static inline unsigned int subset_cover(const unsigned int *opts, unsigned int subset) {
+    unsigned int cover = 0;
+    for (; subset; subset &= subset - 1) {
+        cover |= opts[__builtin_ctz(subset)];
+    }
+    return cover;
+}
+
+// Naked and hidden subsets of 2..max_size in every row, column and box.
+// Only cells (digits) with 2..max_size candidates (places) can be part of a
+// subset, so those are packed into a list and its k-subsets walked as
+// bitmasks. k of them covering exactly k options locks those options:
+// naked digits go from the unit's other cells, hidden subsets lose every
+// other digit. A subset as big as the unit's open cells says nothing.
+int apply_subsets(SudokuGrid *grid, SolverStats *stats, int max_size) {
+    if (max_size > MAX_SUBSET_SIZE) max_size = MAX_SUBSET_SIZE;
+    if (max_size < 2) return 0;
+    
+    PROFILE_START(prof);
+    int progress = 0;
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
+    unsigned int opts[N];
+    unsigned char ids[N];
+    
+    for (int u = 0; u < NUM_UNITS; u++) {
+        const unsigned char *unit = unit_cells[u];
+        unsigned int open = 0;  // unit positions of the empty cells
+        int count = 0;
+        
+        // Naked: cells and their candidate digits
+        for (int k = 0; k < N; k++) {
+            if (cells[unit[k]] != UNASSIGNED) continue;
+            open |= 1 << k;
+            int n = __builtin_popcount(cand[unit[k]]);
+            if (n >= 2 && n <= max_size) {
+                ids[count] = k;
+                opts[count++] = cand[unit[k]];
+            }
+        }
+        int open_count = __builtin_popcount(open);
+        if (open_count < 3) continue;
+        
+        for (int size = 2; size <= max_size && size < open_count && size <= count; size++) {
+            for (unsigned int s = (1u << size) - 1; s < (1u << count); s = next_subset(s)) {
+                unsigned int digits = subset_cover(opts, s);
+                if (__builtin_popcount(digits) != size) continue;
+                
+                unsigned int others = open;
+                for (unsigned int b = s; b; b &= b - 1) others &= ~(1u << ids[__builtin_ctz(b)]);
+                for (; others; others &= others - 1) {
+                    CandidateSet *c = &cand[unit[__builtin_ctz(others)]];
+                    if (*c & digits) {
+                        stats->naked_subsets[size] += __builtin_popcount(*c & digits);
+                        *c &= ~digits;
+                        progress = 1;
+                    }
                 }
             }
-            if (count == 1) {
-                grid->cells[last_row][j] = num;
-                update_candidates(grid, last_row, j, num);
-                grid->empty_cells--;
-                stats->hidden_singles_found++;
-                progress = 1;
+        }
+        
+        // Hidden: unplaced digits and the unit positions they can go to
+        count = 0;
+        for (int d = 0; d < N; d++) {
+            unsigned int places = 0;
+            for (unsigned int o = open; o; o &= o - 1) {
+                int k = __builtin_ctz(o);
+                if (cand[unit[k]] & (1 << d)) places |= 1 << k;
+            }
+            int n = __builtin_popcount(places);
+            if (n >= 2 && n <= max_size) {
+                ids[count] = d;
+                opts[count++] = places;
             }
         }
-    }
-    
-    // Check boxes
-    for (int box = 0; box < 9; box++) {
-        int box_row = (box / 3) * 3;
-        int box_col = (box % 3) * 3;
         
-        for (int num = 1; num <= 9; num++) {
-            int count = 0, last_i = -1, last_j = -1;
-            for (int i = 0; i < 3; i++) {
-                for (int j = 0; j < 3; j++) {
-                    int r = box_row + i;
-                    int c = box_col + j;
-                    if (grid->cells[r][c] == UNASSIGNED && 
-                        (grid->candidates[r][c] & (1 << (num - 1)))) {
-                        count++;
-                        last_i = r;
-                        last_j = c;
+        for (int size = 2; size <= max_size && size < open_count && size <= count; size++) {
+            for (unsigned int s = (1u << size) - 1; s < (1u << count); s = next_subset(s)) {
+                unsigned int places = subset_cover(opts, s);
+                if (__builtin_popcount(places) != size) continue;
+                
+                CandidateSet digits = 0;
+                for (unsigned int b = s; b; b &= b - 1) digits |= 1 << ids[__builtin_ctz(b)];
+                for (; places; places &= places - 1) {
+                    CandidateSet *c = &cand[unit[__builtin_ctz(places)]];
+                    if (*c & ~digits) {
+                        stats->hidden_subsets[size] += __builtin_popcount(*c & ~digits);
+                        *c &= digits;
+                        progress = 1;
                     }
                 }
             }
-            if (count == 1) {
-                grid->cells[last_i][last_j] = num;
-                update_candidates(grid, last_i, last_j, num);
-                grid->empty_cells--;
-                stats->hidden_singles_found++;
-                progress = 1;
-            }
         }
     }
     
+    PROFILE_STOP(prof, PROF_SUBSETS);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, TECH_SUBSETS);
     return progress;
 }
 
-int apply_naked_pairs(SudokuGrid *grid, SolverStats *stats) {
+int apply_pointing_pairs(SudokuGrid *grid, SolverStats *stats) {
+    PROFILE_START(prof);
     int progress = 0;
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
     
-    // Check rows for naked pairs
-    for (int i = 0; i < N; i++) {
-        for (int j1 = 0; j1 < N - 1; j1++) {
-            if (grid->cells[i][j1] == UNASSIGNED && count_candidates(grid->candidates[i][j1]) == 2) {
-                for (int j2 = j1 + 1; j2 < N; j2++) {
-                    if (grid->cells[i][j2] == UNASSIGNED && 
-                        grid->candidates[i][j1] == grid->candidates[i][j2]) {
-                        // Found naked pair, eliminate from other cells in row
-                        CandidateSet pair = grid->candidates[i][j1];
-                        for (int j = 0; j < N; j++) {
-                            if (j != j1 && j != j2 && grid->cells[i][j] == UNASSIGNED) {
-                                if (grid->candidates[i][j] & pair) {
-                                    grid->candidates[i][j] &= ~pair;
-                                    stats->naked_pairs_found++;
-                                    progress = 1;
-                                }
-                            }
-                        }
+    // For each box, check if a number only appears in one row/column
+    for (int box = 0; box < 9; box++) {
+        const unsigned char *box_cells = unit_cells[BOX_UNIT(box)];
+        
+        for (int num = 1; num <= 9; num++) {
+            CandidateSet bit = 1 << (num - 1);
+            int rows = 0, cols = 0;  // bitmasks of board rows/cols holding it
+            
+            for (int k = 0; k < N; k++) {
+                int cell = box_cells[k];
+                if (cells[cell] == UNASSIGNED && (cand[cell] & bit)) {
+                    rows |= 1 << cell_row[cell];
+                    cols |= 1 << cell_col[cell];
+                }
+            }
+            
+            // If only one row, eliminate from rest of that row
+            if (rows && (rows & (rows - 1)) == 0) {
+                const unsigned char *line = unit_cells[ROW_UNIT(__builtin_ctz(rows))];
+                for (int k = 0; k < N; k++) {
+                    int cell = line[k];
+                    if (cell_box[cell] != box && cells[cell] == UNASSIGNED && (cand[cell] & bit)) {
+                        cand[cell] &= ~bit;
+                        stats->pointing_pairs_found++;
+                        progress = 1;
+                    }
+                }
+            }
+            
+            // If only one column, eliminate from rest of that column
+            if (cols && (cols & (cols - 1)) == 0) {
+                const unsigned char *line = unit_cells[COL_UNIT(__builtin_ctz(cols))];
+                for (int k = 0; k < N; k++) {
+                    int cell = line[k];
+                    if (cell_box[cell] != box && cells[cell] == UNASSIGNED && (cand[cell] & bit)) {
+                        cand[cell] &= ~bit;
+                        stats->pointing_pairs_found++;
+                        progress = 1;
                     }
                 }
             }
         }
     }
     
+    PROFILE_STOP(prof, PROF_POINTING_PAIRS);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, TECH_POINTING_PAIRS);
     return progress;
 }
 
-int apply_pointing_pairs(SudokuGrid *grid, SolverStats *stats) {
+// X-Wing (size 2) and Swordfish (size 3), digit by digit. If a digit's
+// places in size rows lie in just size columns, those rows take the digit in
+// every one of the columns, so it goes from the rest of each column (and the
+// same with rows and columns swapped). Lines are 9-bit masks of where the
+// digit can go; the size-subsets of the lines with 2..size places are
+// walked as bitmasks like in apply_subsets().
+int apply_fish(SudokuGrid *grid, SolverStats *stats, int size) {
+    PROFILE_START(prof);
     int progress = 0;
+    unsigned long long *found = size == 2 ? &stats->xwing_eliminations : &stats->swordfish_eliminations;
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
     
-    // For each box, check if a number only appears in one row/column
-    for (int box = 0; box < 9; box++) {
-        int box_row = (box / 3) * 3;
-        int box_col = (box % 3) * 3;
+    for (int d = 0; d < N; d++) {
+        CandidateSet bit = 1 << d;
         
-        for (int num = 1; num <= 9; num++) {
-            int rows[3] = {0}, cols[3] = {0};
-            
-            // Count which rows/cols have this candidate in the box
-            for (int i = 0; i < 3; i++) {
-                for (int j = 0; j < 3; j++) {
-                    int r = box_row + i;
-                    int c = box_col + j;
-                    if (grid->cells[r][c] == UNASSIGNED && 
-                        (grid->candidates[r][c] & (1 << (num - 1)))) {
-                        rows[i] = 1;
-                        cols[j] = 1;
-                    }
+        // by_row[r] = columns of row r that can take d, by_col the transpose
+        unsigned int by_line[2][N] = {{0}};
+        for (int cell = 0; cell < NUM_CELLS; cell++) {
+            if (cells[cell] == UNASSIGNED && (cand[cell] & bit)) {
+                by_line[0][cell_row[cell]] |= 1 << cell_col[cell];
+                by_line[1][cell_col[cell]] |= 1 << cell_row[cell];
+            }
+        }
+        
+        for (int dir = 0; dir < 2; dir++) {
+            unsigned int opts[N];
+            unsigned char ids[N];
+            int count = 0;
+            for (int line = 0; line < N; line++) {
+                int n = __builtin_popcount(by_line[dir][line]);
+                if (n >= 2 && n <= size) {
+                    ids[count] = line;
+                    opts[count++] = by_line[dir][line];
                 }
             }
+            if (count < size) continue;
             
-            // If only one row, eliminate from rest of that row
-            int row_count = rows[0] + rows[1] + rows[2];
-            if (row_count == 1) {
-                int target_row = box_row + (rows[0] ? 0 : (rows[1] ? 1 : 2));
-                for (int j = 0; j < N; j++) {
-                    if (j < box_col || j >= box_col + 3) {
-                        if (grid->cells[target_row][j] == UNASSIGNED) {
-                            if (grid->candidates[target_row][j] & (1 << (num - 1))) {
-                                grid->candidates[target_row][j] &= ~(1 << (num - 1));
-                                stats->pointing_pairs_found++;
-                                progress = 1;
-                            }
-                        }
+            for (unsigned int s = (1u << size) - 1; s < (1u << count); s = next_subset(s)) {
+                unsigned int cover = subset_cover(opts, s);
+                if (__builtin_popcount(cover) != size) continue;
+                
+                unsigned int base = 0;
+                for (unsigned int b = s; b; b &= b - 1) base |= 1 << ids[__builtin_ctz(b)];
+                
+                // Every other line loses d in the covered positions
+                for (int line = 0; line < N; line++) {
+                    if (base & (1 << line)) continue;
+                    for (unsigned int c = by_line[dir][line] & cover; c; c &= c - 1) {
+                        int pos = __builtin_ctz(c);
+                        int cell = dir == 0 ? line * N + pos : pos * N + line;
+                        cand[cell] &= ~bit;
+                        by_line[dir][line] &= ~(1u << pos);
+                        by_line[!dir][pos] &= ~(1u << line);
+                        (*found)++;
+                        progress = 1;
                     }
                 }
             }
+        }
+    }
+    
+    PROFILE_STOP(prof, size == 2 ? PROF_XWING : PROF_SWORDFISH);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, size == 2 ? TECH_XWING : TECH_SWORDFISH);
+    return progress;
+}
+
+static inline int sees(int a, int b) {
+    return a != b && (cell_row[a] == cell_row[b] || cell_col[a] == cell_col[b] ||
+                      cell_box[a] == cell_box[b]);
+}
+
+// XY-Wing: a pivot {x,y} with peers {x,z} and {y,z}. Whichever value the
+// pivot takes one of the pincers is z, so z goes from every cell that sees
+// both pincers.
+int apply_xy_wing(SudokuGrid *grid, SolverStats *stats) {
+    PROFILE_START(prof);
+    int progress = 0;
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
+    
+    for (int pivot = 0; pivot < NUM_CELLS; pivot++) {
+        CandidateSet xy = cand[pivot];
+        if (cells[pivot] != UNASSIGNED || __builtin_popcount(xy) != 2) continue;
+        const unsigned char *peers = cell_peers[pivot];
+        
+        for (int i = 0; i < NUM_PEERS; i++) {
+            int a = peers[i];
+            CandidateSet xz = cand[a];
+            if (cells[a] != UNASSIGNED || __builtin_popcount(xz) != 2 ||
+                __builtin_popcount(xz & xy) != 1) continue;
             
-            // If only one column, eliminate from rest of that column
-            int col_count = cols[0] + cols[1] + cols[2];
-            if (col_count == 1) {
-                int target_col = box_col + (cols[0] ? 0 : (cols[1] ? 1 : 2));
-                for (int i = 0; i < N; i++) {
-                    if (i < box_row || i >= box_row + 3) {
-                        if (grid->cells[i][target_col] == UNASSIGNED) {
-                            if (grid->candidates[i][target_col] & (1 << (num - 1))) {
-                                grid->candidates[i][target_col] &= ~(1 << (num - 1));
-                                stats->pointing_pairs_found++;
-                                progress = 1;
-                            }
-                        }
+            CandidateSet z = xz & ~xy;
+            CandidateSet yz = (xy & ~xz) | z;
+            for (int j = i + 1; j < NUM_PEERS; j++) {
+                int b = peers[j];
+                if (cells[b] != UNASSIGNED || cand[b] != yz) continue;
+                
+                const unsigned char *a_peers = cell_peers[a];
+                for (int k = 0; k < NUM_PEERS; k++) {
+                    int cell = a_peers[k];
+                    if (cells[cell] == UNASSIGNED && (cand[cell] & z) && sees(cell, b)) {
+                        cand[cell] &= ~z;
+                        stats->xy_wing_eliminations++;
+                        progress = 1;
                     }
                 }
             }
         }
     }
     
+    PROFILE_STOP(prof, PROF_XY_WING);
+    if (progress) TRACE_EVENT(TRACE_TECHNIQUE, TECH_XY_WING);
     return progress;
 }
 
-int apply_constraint_propagation(SudokuGrid *grid, SolverStats *stats) {
+// Basic techniques to a fixpoint, then the enabled extras one at a time,
+// going back to the cheap ones as soon as something was eliminated
+static int propagate_all(SudokuGrid *grid, SolverStats *stats, const SearchConfig *config) {
+    int extras = config->extra_techniques;
     int progress = 1;
     while (progress) {
         progress = 0;
         progress |= apply_naked_singles(grid, stats);
         progress |= apply_hidden_singles(grid, stats);
-        progress |= apply_naked_pairs(grid, stats);
+        progress |= apply_subsets(grid, stats, config->subset_size);
         progress |= apply_pointing_pairs(grid, stats);
+        if (progress || !extras || grid->empty_cells == 0) continue;
+        
+        if (extras & EXTRA_XWING) progress = apply_fish(grid, stats, 2);
+        if (!progress && (extras & EXTRA_SWORDFISH)) progress = apply_fish(grid, stats, 3);
+        if (!progress && (extras & EXTRA_XY_WING)) progress = apply_xy_wing(grid, stats);
+    }
+    return grid->empty_cells == 0;
+}
+
+// Full propagation with the default techniques (search_config)
+int apply_constraint_propagation(SudokuGrid *grid, SolverStats *stats) {
+    return propagate_all(grid, stats, &search_config);
+}
+
+int apply_propagation_level(SudokuGrid *grid, SolverStats *stats, const SearchConfig *config) {
+    if (config->propagation == PROPAGATE_ALL) {
+        return propagate_all(grid, stats, config);
+    }
+    
+    int progress = 1;
+    while (progress) {
+        progress = 0;
+        progress |= apply_naked_singles(grid, stats);
+        progress |= apply_hidden_singles(grid, stats);
     }
     return grid->empty_cells == 0;
 }
@@ -400,6 +606,189 @@ int find_best_cell(SudokuGrid *grid, int *row, int *col) {
     return (*row != -1);
 }
 
+// xorshift32 - cheap per-search random numbers, no shared state between threads
+static unsigned int next_random(unsigned int *rng) {
+    unsigned int x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+// Number of empty cells sharing a row, column or box with (row, col)
+static int count_empty_peers(SudokuGrid *grid, int row, int col) {
+    const int *cells = &grid->cells[0][0];
+    const unsigned char *peers = cell_peers[row * N + col];
+    int degree = 0;
+    for (int k = 0; k < NUM_PEERS; k++) {
+        degree += cells[peers[k]] == UNASSIGNED;
+    }
+    return degree;
+}
+
+// Number of empty peers that would lose num if it went into (row, col)
+static int count_value_conflicts(SudokuGrid *grid, int row, int col, int num) {
+    const CandidateSet *cand = &grid->candidates[0][0];
+    const unsigned char *peers = cell_peers[row * N + col];
+    CandidateSet bit = 1 << (num - 1);
+    int conflicts = 0;
+    for (int k = 0; k < NUM_PEERS; k++) {
+        conflicts += (cand[peers[k]] & bit) != 0;
+    }
+    return conflicts;
+}
+
+// MRV with optional degree tie-breaking. When restarts or random ordering are
+// on, remaining ties are broken randomly so each restart sees a different tree.
+int select_branch_cell(SudokuGrid *grid, const SearchConfig *config, unsigned int *rng,
+                       SolverStats *stats, int *row, int *col) {
+    int randomize = config->value_order == VALUE_RANDOM || config->restart_nodes > 0;
+    if (config->cell_order == CELL_MRV && !randomize) {
+        return find_best_cell(grid, row, col);
+    }
+    
+    int min_candidates = 10, best_degree = -1, ties = 0;
+    int first_row = -1, first_col = -1;
+    *row = -1;
+    *col = -1;
+    
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            if (grid->cells[i][j] != UNASSIGNED) continue;
+            
+            int cand_count = count_candidates(grid->candidates[i][j]);
+            if (cand_count == 0) return 0; // No solution
+            if (cand_count > min_candidates) continue;
+            
+            int degree = 0;
+            if (config->cell_order == CELL_MRV_DEGREE) {
+                degree = count_empty_peers(grid, i, j);
+            }
+            
+            if (cand_count < min_candidates) {
+                min_candidates = cand_count;
+                best_degree = degree;
+                ties = 1;
+                first_row = *row = i;
+                first_col = *col = j;
+            } else if (degree > best_degree) {
+                best_degree = degree;
+                ties = 1;
+                *row = i;
+                *col = j;
+            } else if (degree == best_degree && randomize) {
+                // reservoir sampling over the equal cells
+                ties++;
+                if (next_random(rng) % ties == 0) {
+                    *row = i;
+                    *col = j;
+                }
+            }
+        }
+    }
+    
+    if (*row != first_row || *col != first_col) {
+        stats->degree_tiebreaks += config->cell_order == CELL_MRV_DEGREE;
+    }
+    return (*row != -1);
+}
+
+// Fill values[] with the candidates of (row, col) in the order they should be
+// tried. Returns how many there are.
+int order_values(SudokuGrid *grid, int row, int col, const SearchConfig *config,
+                 unsigned int *rng, SolverStats *stats, unsigned char *values) {
+    CandidateSet cands = grid->candidates[row][col];
+    int count = 0;
+    while (cands) {
+        values[count++] = __builtin_ctz(cands) + 1;
+        cands &= cands - 1;
+    }
+    if (count < 2) return count;
+    
+    int score[N + 1];
+    switch (config->value_order) {
+    case VALUE_ASCENDING:
+        return count;
+        
+    case VALUE_LCV:
+        for (int k = 0; k < count; k++) {
+            score[values[k]] = count_value_conflicts(grid, row, col, values[k]);
+        }
+        stats->lcv_orderings++;
+        break;
+        
+    case VALUE_FREQUENCY: {
+        // Digits placed most often have the fewest spots left, so they're
+        // the most likely to be forced - sort by how often they're missing
+        int placed[N + 1] = {0};
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                placed[grid->cells[i][j]]++;
+            }
+        }
+        for (int k = 0; k < count; k++) {
+            score[values[k]] = N - placed[values[k]];
+        }
+        stats->frequency_orderings++;
+        break;
+    }
+        
+    case VALUE_RANDOM:
+        for (int k = count - 1; k > 0; k--) {
+            int r = next_random(rng) % (k + 1);
+            unsigned char tmp = values[k];
+            values[k] = values[r];
+            values[r] = tmp;
+        }
+        stats->random_orderings++;
+        return count;
+    }
+    
+    // Insertion sort by score - at most 9 values, stable for equal scores
+    for (int k = 1; k < count; k++) {
+        unsigned char v = values[k];
+        int m = k - 1;
+        while (m >= 0 && score[values[m]] > score[v]) {
+            values[m + 1] = values[m];
+            m--;
+        }
+        values[m + 1] = v;
+    }
+    return count;
+}
+
+// Parse a comma separated heuristic list like "degree,lcv" or "random,restarts"
+int parse_search_config(const char *spec, SearchConfig *config) {
+    char buffer[128];
+    strncpy(buffer, spec, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+    
+    for (char *tok = strtok(buffer, ","); tok; tok = strtok(NULL, ",")) {
+        if (strcmp(tok, "mrv") == 0) config->cell_order = CELL_MRV;
+        else if (strcmp(tok, "degree") == 0) config->cell_order = CELL_MRV_DEGREE;
+        else if (strcmp(tok, "ascending") == 0) config->value_order = VALUE_ASCENDING;
+        else if (strcmp(tok, "lcv") == 0) config->value_order = VALUE_LCV;
+        else if (strcmp(tok, "freq") == 0) config->value_order = VALUE_FREQUENCY;
+        else if (strcmp(tok, "random") == 0) config->value_order = VALUE_RANDOM;
+        else if (strcmp(tok, "restarts") == 0) config->restart_nodes = RESTART_BASE_NODES;
+        else if (strcmp(tok, "singles") == 0) config->propagation = PROPAGATE_SINGLES;
+        else if (strcmp(tok, "full") == 0) config->propagation = PROPAGATE_ALL;
+        else if (strcmp(tok, "deterministic") == 0) config->deterministic = 1;
+        else if (strcmp(tok, "tt") == 0) config->transpositions = 1;
+        else if (strcmp(tok, "nogoods") == 0) config->nogoods = 1;
+        else if (strcmp(tok, "xwing") == 0) config->extra_techniques |= EXTRA_XWING;
+        else if (strcmp(tok, "swordfish") == 0) config->extra_techniques |= EXTRA_SWORDFISH;
+        else if (strcmp(tok, "xywing") == 0) config->extra_techniques |= EXTRA_XY_WING;
+        else if (strcmp(tok, "fish") == 0) config->extra_techniques |= EXTRA_XWING | EXTRA_SWORDFISH;
+        else if (strncmp(tok, "subsets", 7) == 0 && tok[7] >= '0' && tok[7] <= '0' + MAX_SUBSET_SIZE && !tok[8]) {
+            config->subset_size = tok[7] - '0';
+        }
+        else return 0;
+    }
+    return 1;
+}
+
 double estimate_difficulty(SudokuGrid *grid) {
     double score = 0;
     score += grid->empty_cells * 1.0;
@@ -418,74 +807,593 @@ double estimate_difficulty(SudokuGrid *grid) {
     return score;
 }
 
-// ========== Backtracking with Advanced Techniques ==========
+// ========== Solve Limits ==========
 
-int solve_with_techniques(SudokuGrid *grid, SolverStats *stats) {
-    stats->nodes_explored++;
-    
-    // Apply constraint propagation first
-    if (apply_constraint_propagation(grid, stats)) {
-        return 1; // Solved without backtracking
+// Set up the shared budget for one solve starting at start. Returns the
+// pointer to put in SearchConfig.budget, NULL if there's nothing to enforce.
+SolveBudget *budget_init(SolveBudget *budget, const SolveLimits *limits, double start) {
+    if (!limits || (limits->time_limit <= 0 && limits->max_nodes == 0)) {
+        return NULL;
+    }
+    budget->deadline = limits->time_limit > 0 ? start + limits->time_limit : 0;
+    budget->max_nodes = limits->max_nodes;
+    budget->nodes = 0;
+    budget->expired = 0;
+    return budget;
+}
+
+// Charge nodes to the budget and see if it's gone. Called every
+// BUDGET_CHECK_INTERVAL nodes, not per node.
+int budget_expired(SolveBudget *budget, unsigned long long nodes) {
+    unsigned long long used;
+    if (budget->expired) return 1;
+    
+    #pragma omp atomic capture
+    used = budget->nodes += nodes;
+    
+    if ((budget->max_nodes && used >= budget->max_nodes) ||
+        (budget->deadline > 0 && omp_get_wtime() >= budget->deadline)) {
+        budget->expired = 1;
+    }
+    return budget->expired;
+}
+
+static int out_of_budget(const SearchConfig *config) {
+    return config->budget && config->budget->expired;
+}
+
+// Our own cancel flag, or the one of the V1 branch we're nested in
+static int search_cancelled(const SearchConfig *config, volatile int *stop) {
+    return (stop && *stop) || (config->outer_stop && *config->outer_stop);
+}
+
+// ========== Transposition Table ==========
+
+unsigned long long grid_hash(SudokuGrid *grid) {
+    int *cells = &grid->cells[0][0];
+    unsigned long long hash = 0;
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        hash ^= zobrist[cell][cells[cell]];
     }
+    return hash;
+}
+
+TranspositionTable *tt_create(int bits) {
+    TranspositionTable *tt = malloc(sizeof(TranspositionTable));
+    tt->mask = (1ULL << bits) - 1;
+    tt->keys = calloc(tt->mask + 1, sizeof(unsigned long long));
+    if (!tt->keys) {
+        printf("Error: Could not allocate transposition table\n");
+        exit(1);
+    }
+    return tt;
+}
+
+void tt_free(TranspositionTable *tt) {
+    if (!tt) return;
+    free(tt->keys);
+    free(tt);
+}
+
+int tt_probe(TranspositionTable *tt, unsigned long long key) {
+    for (int w = 0; w < TT_WAYS; w++) {
+        unsigned long long slot;
+        #pragma omp atomic read
+        slot = tt->keys[(key + w) & tt->mask];
+        if (slot == key) return 1;
+        if (slot == 0) return 0;
+    }
+    return 0;
+}
+
+// First empty slot of the key's ways, else evict one picked by the key's top bits
+void tt_store(TranspositionTable *tt, unsigned long long key) {
+    unsigned long long index = (key + (key >> 62)) & tt->mask;
+    for (int w = 0; w < TT_WAYS; w++) {
+        unsigned long long slot;
+        #pragma omp atomic read
+        slot = tt->keys[(key + w) & tt->mask];
+        if (slot == key) return;
+        if (slot == 0) {
+            index = (key + w) & tt->mask;
+            break;
+        }
+    }
+    #pragma omp atomic write
+    tt->keys[index] = key;
+}
+
+// A fresh table for one solve if the config asks for one
+static TranspositionTable *open_transpositions(const SearchConfig *config) {
+    return config->transpositions ? tt_create(TT_BITS) : NULL;
+}
+
+// ========== Nogood Store ==========
+
+#define NOGOOD_LITERAL(cell, value) ((unsigned short)((cell) << 4 | (value)))
+
+NogoodStore *nogood_create(SudokuGrid *root) {
+    NogoodStore *store = calloc(1, sizeof(NogoodStore));
+    if (!store) {
+        printf("Error: Could not allocate nogood store\n");
+        exit(1);
+    }
+    copy_grid(root, &store->root);
+    return store;
+}
+
+void nogood_free(NogoodStore *store) {
+    free(store);
+}
+
+// A fresh store for one solve if the config asks for one. Deterministic runs
+// leave it off: what one branch learns would change another's node count
+// depending on timing.
+static NogoodStore *open_nogoods(const SearchConfig *config, SudokuGrid *root) {
+    return config->nogoods && !config->deterministic ? nogood_create(root) : NULL;
+}
+
+// -1 if some nogood holds in full. A nogood with one assignment still open
+// forbids that one, so the value goes from the cell's candidates; returns 1
+// if that happened.
+int apply_nogoods(NogoodStore *store, SudokuGrid *grid, SolverStats *stats) {
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
+    unsigned int stored;
+    #pragma omp atomic read
+    stored = store->next;
+    if (stored > NOGOOD_CAPACITY) stored = NOGOOD_CAPACITY;
     
-    // Check for invalid state
-    int row, col;
-    if (!find_best_cell(grid, &row, &col)) {
-        return 0; // No valid cell found
+    int progress = 0;
+    for (unsigned int i = 0; i < stored; i++) {
+        unsigned long long entry;
+        #pragma omp atomic read
+        entry = store->entries[i];
+        if (!entry) continue;
+        
+        int open = -1, open_bit = 0, holds = 1;
+        for (; entry; entry >>= 12) {
+            int cell = (entry & 0xFFF) >> 4, value = entry & 0xF;
+            if (cells[cell] == value) continue;
+            if (open < 0 && cells[cell] == UNASSIGNED && (cand[cell] & (1 << (value - 1)))) {
+                open = cell;
+                open_bit = 1 << (value - 1);
+                continue;
+            }
+            holds = 0;  // one is already false, or two are open
+            break;
+        }
+        if (!holds) continue;
+        
+        if (open < 0) {
+            stats->nogood_prunes++;
+            return -1;
+        }
+        cand[open] &= ~open_bit;
+        stats->nogood_eliminations++;
+        progress = 1;
+    }
+    return progress;
+}
+
+static void nogood_add(NogoodStore *store, const unsigned short *lits, int count, SolverStats *stats) {
+    unsigned long long entry = 0;
+    for (int k = 0; k < count; k++) {
+        entry |= (unsigned long long)lits[k] << (12 * k);
+    }
+    unsigned int slot;
+    #pragma omp atomic capture
+    slot = store->next++;
+    #pragma omp atomic write
+    store->entries[slot % NOGOOD_CAPACITY] = entry;
+    stats->nogoods_learned++;
+}
+
+static int grid_dead(SudokuGrid *grid) {
+    int *cells = &grid->cells[0][0];
+    CandidateSet *cand = &grid->candidates[0][0];
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        if (cells[cell] == UNASSIGNED && !cand[cell]) return 1;
+    }
+    return 0;
+}
+
+// 1 if the store's root plus these assignments dies in propagation alone.
+// Singles only: this runs once per assignment of every nogood shrunk, and
+// full propagation from the root costs more than the nodes it saves.
+static int nogood_fails(NogoodStore *store, const unsigned short *lits, int count,
+                        const SearchConfig *config) {
+    SudokuGrid g;
+    SolverStats scratch = {0};
+    int *cells = &g.cells[0][0];
+    copy_grid(&store->root, &g);
+    
+    for (int k = 0; k < count; k++) {
+        int cell = lits[k] >> 4, value = lits[k] & 0xF;
+        if (cells[cell] == value) continue;
+        if (cells[cell] != UNASSIGNED || !(g.candidates[cell_row[cell]][cell_col[cell]] & (1 << (value - 1)))) {
+            return 1;
+        }
+        cells[cell] = value;
+        g.empty_cells--;
+        update_candidates(&g, cell_row[cell], cell_col[cell], value);
+    }
+    SearchConfig singles = *config;
+    singles.propagation = PROPAGATE_SINGLES;
+    if (apply_propagation_level(&g, &scratch, &singles)) return 0;
+    return grid_dead(&g);
+}
+
+// A node at depth that failed: the assumptions (where the solve's root is
+// already past the store's) plus the branch decisions down to it. A leaf
+// that died in propagation is shrunk by dropping every assignment it still
+// dies without; an exhausted subtree is only kept if it's small already.
+static void learn_nogood(const SearchConfig *config, const unsigned short *assumed, int num_assumed,
+                         SearchNode *nodes, int depth, int leaf, SolverStats *stats) {
+    unsigned short lits[NOGOOD_MINIMIZE_MAX];
+    int count = num_assumed + depth;
+    if (count == 0 || count > (leaf ? NOGOOD_MINIMIZE_MAX : MAX_NOGOOD_SIZE)) return;
+    
+    memcpy(lits, assumed, num_assumed * sizeof(unsigned short));
+    for (int d = 0; d < depth; d++) {
+        SearchNode *node = &nodes[d];
+        lits[num_assumed + d] = NOGOOD_LITERAL(node->row * N + node->col, node->values[node->next - 1]);
     }
     
-    // Try each candidate for the selected cell
-    CandidateSet cands = grid->candidates[row][col];
-    int num_cands = count_candidates(cands);
+    // Every drop is checked by replaying from the root, so the result is
+    // sound even if the replay couldn't show the full set dead
+    if (leaf) {
+        for (int k = 0; k < count && count > 1; ) {
+            unsigned short dropped = lits[k];
+            lits[k] = lits[count - 1];
+            if (nogood_fails(config->nogood_store, lits, count - 1, config)) {
+                count--;
+            } else {
+                lits[count - 1] = lits[k];
+                lits[k] = dropped;
+                k++;
+            }
+        }
+    }
+    if (count <= MAX_NOGOOD_SIZE) nogood_add(config->nogood_store, lits, count, stats);
+}
+
+// ========== Backtracking with Advanced Techniques ==========
+// Iterative DFS: the recursion is replaced by a preallocated stack of
+// SearchNodes, so there are no call frames and no risk of stack overflow
+
+SearchStack *search_stack_create(void) {
+    SearchStack *stack = malloc(sizeof(SearchStack));
+    if (!stack) {
+        printf("Error: Could not allocate search stack\n");
+        exit(1);
+    }
+    stack->top = 0;
+    return stack;
+}
+
+void search_stack_free(SearchStack *stack) {
+    free(stack);
+}
+
+// Take one untried branch from the bottom (shallowest) node of the stack.
+// Those branches are the biggest subtrees, so they're the best ones to hand
+// to another thread. Caller has to make sure the owner isn't running.
+int search_stack_steal(SearchStack *stack, SudokuGrid *out) {
+    for (int d = 0; d < stack->top; d++) {
+        SearchNode *node = &stack->nodes[d];
+        if (node->next < node->count) {
+            // The owner takes values from the front, so steal from the back
+            int num = node->values[--node->count];
+            // Its subtree isn't all ours any more, and neither is any
+            // ancestor's, so none of them can be stored dead when popped
+            for (int a = 0; a <= d; a++) stack->nodes[a].partial = 1;
+            TRACE_EVENT(TRACE_STEAL, d);
+            
+            copy_grid(&node->grid, out);
+            out->cells[node->row][node->col] = num;
+            out->empty_cells--;
+            update_candidates(out, node->row, node->col, num);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int solve_iterative(SearchStack *stack, SudokuGrid *grid, SolverStats *stats,
+                    const SearchConfig *config, volatile int *stop) {
+    SearchNode *nodes = stack->nodes;
+    unsigned int rng = config->seed ? config->seed : 1;
+    unsigned long long restart_at = config->restart_nodes;
+    unsigned long long nodes_since_restart = 0;
+    unsigned long long budget_end = config->node_limit ? stats->nodes_explored + config->node_limit : 0;
+    unsigned long long since_check = 0, check_every = BUDGET_CHECK_INTERVAL;
+    if (config->budget && config->budget->max_nodes && config->budget->max_nodes < check_every) {
+        check_every = config->budget->max_nodes;
+    }
+    stack->top = 0;
+    copy_grid(grid, &nodes[0].grid);
+    TRACE_EVENT(TRACE_SEARCH_BEGIN, 0);
+    
+    // What this search starts from on top of the nogood store's root (a V2
+    // branch's first assignment, say). Nogoods learned here must include it;
+    // if it's too long to fit, this search only uses the store.
+    NogoodStore *store = config->nogood_store;
+    unsigned short assumed[NOGOOD_MINIMIZE_MAX];
+    int num_assumed = 0, learning = store != NULL;
+    for (int cell = 0; learning && cell < NUM_CELLS; cell++) {
+        int value = grid->cells[cell_row[cell]][cell_col[cell]];
+        if (value == UNASSIGNED || store->root.cells[cell_row[cell]][cell_col[cell]] == value) continue;
+        if (num_assumed == NOGOOD_MINIMIZE_MAX) learning = 0;
+        else assumed[num_assumed++] = NOGOOD_LITERAL(cell, value);
+    }
     
-    for (int i = 0; i < num_cands; i++) {
-        int num = get_candidate(cands, i);
+    for (;;) {
+        SearchNode *node = &nodes[stack->top];
+        stats->nodes_explored++;
+        nodes_since_restart++;
+        TRACE_EVENT(TRACE_NODE, stack->top);
         
-        // Make a copy and try this value
-        SudokuGrid temp_grid;
-        copy_grid(grid, &temp_grid);
+        // Already known dead (another worker, or before a restart)
+        int dead = 0;
+        if (config->tt) {
+            node->key = GRID_KEY(&node->grid);
+            dead = tt_probe(config->tt, node->key);
+            stats->tt_hits += dead;
+        }
+        
+        if (!dead && store) dead = apply_nogoods(store, &node->grid, stats) < 0;
+        
+        // Apply constraint propagation first, and again as long as the
+        // nogoods take out more candidates
+        int propagated = dead;
+        while (!propagated) {
+            if (apply_propagation_level(&node->grid, stats, config)) {
+                copy_grid(&node->grid, grid);
+                TRACE_EVENT(TRACE_SEARCH_END, 1);
+                return 1;
+            }
+            int learned = store ? apply_nogoods(store, &node->grid, stats) : 0;
+            if (learned < 0) dead = 1;
+            propagated = learned <= 0;
+        }
         
-        temp_grid.cells[row][col] = num;
-        temp_grid.empty_cells--;
-        update_candidates(&temp_grid, row, col, num);
+        // Valid state - this node becomes a branching point
+        int row, col;
+        PROFILE_START(prof);
+        if (!dead && select_branch_cell(&node->grid, config, &rng, stats, &row, &col)) {
+            node->row = row;
+            node->col = col;
+            node->count = order_values(&node->grid, row, col, config, &rng, stats, node->values);
+            node->next = 0;
+            node->partial = 0;
+            stack->top++;
+        } else if (!dead) {
+            if (config->tt) {
+                tt_store(config->tt, node->key);
+                stats->tt_stores++;
+            }
+            if (learning) learn_nogood(config, assumed, num_assumed, nodes, stack->top, 1, stats);
+        }
+        PROFILE_STOP(prof, PROF_BRANCHING);
+        
+        // Heavy-tailed run - throw the tree away and start over with a
+        // bigger cutoff. The root grid is still intact in nodes[0].
+        if (restart_at && nodes_since_restart >= restart_at && stack->top > 1) {
+            stack->top = 0;
+            nodes_since_restart = 0;
+            restart_at = (unsigned long long)(restart_at * RESTART_GROWTH);
+            stats->restarts++;
+            continue;
+        }
+        
+        // Backtrack to the deepest node that still has untried values. A node
+        // left this way had every branch searched, so it's dead too.
+        int depth = stack->top;
+        while (stack->top > 0 && nodes[stack->top - 1].next == nodes[stack->top - 1].count) {
+            stack->top--;
+            if (nodes[stack->top].partial) continue;
+            if (config->tt) {
+                tt_store(config->tt, nodes[stack->top].key);
+                stats->tt_stores++;
+            }
+            if (learning) learn_nogood(config, assumed, num_assumed, nodes, stack->top, 0, stats);
+        }
+        if (stack->top < depth) TRACE_EVENT(TRACE_BACKTRACK, stack->top);
+        if (stack->top == 0) {
+            TRACE_EVENT(TRACE_SEARCH_END, 0);
+            return 0;
+        }
+        if (search_cancelled(config, stop)) {
+            TRACE_EVENT(TRACE_CANCEL, stack->top);
+            TRACE_EVENT(TRACE_SEARCH_END, 0);
+            return 0;  // somebody else already found it
+        }
+        if (config->budget && ++since_check >= check_every) {
+            since_check = 0;
+            if (budget_expired(config->budget, check_every)) budget_end = stats->nodes_explored;
+        }
+        if (budget_end && stats->nodes_explored >= budget_end) {
+            copy_grid(&nodes[0].grid, grid);  // propagated root, no guesses
+            TRACE_EVENT(TRACE_SEARCH_END, (unsigned int)SEARCH_OVER_BUDGET);
+            return SEARCH_OVER_BUDGET;  // untried branches are still on the stack
+        }
+        
+        SearchNode *parent = &nodes[stack->top - 1];
+        int num = parent->values[parent->next++];
+        
+        SudokuGrid *child = &nodes[stack->top].grid;
+        copy_grid(&parent->grid, child);
+        child->cells[parent->row][parent->col] = num;
+        child->empty_cells--;
+        update_candidates(child, parent->row, parent->col, num);
+        TRACE_EVENT(TRACE_BRANCH, (parent->row * N + parent->col) * 16 + num);
         
         stats->backtrack_count++;
+    }
+}
+
+static int solve_with_config(SudokuGrid *grid, SolverStats *stats, const SearchConfig *config) {
+    SearchStack *stack = search_stack_create();
+    int result = solve_iterative(stack, grid, stats, config, NULL);
+    search_stack_free(stack);
+    if (result == SEARCH_OVER_BUDGET) stats->timed_out = 1;
+    return result;
+}
+
+int solve_with_techniques(SudokuGrid *grid, SolverStats *stats) {
+    return solve_with_config(grid, stats, &search_config);
+}
+
+// Count solutions, stopping at limit (2 is enough to check uniqueness).
+// Same DFS as solve_iterative(), but a solved leaf just counts and backtracks.
+int count_solutions(SudokuGrid *grid, int limit) {
+    static const SearchConfig plain = { .cell_order = CELL_MRV, .value_order = VALUE_ASCENDING, .seed = 1,
+                                        .propagation = PROPAGATE_ALL, .subset_size = 2 };
+    SearchStack *stack = search_stack_create();
+    SearchNode *nodes = stack->nodes;
+    SolverStats stats = {0};
+    int found = 0;
+    
+    stack->top = 0;
+    copy_grid(grid, &nodes[0].grid);
+    init_candidates(&nodes[0].grid);
+    
+    for (;;) {
+        SearchNode *node = &nodes[stack->top];
+        int row, col;
         
-        if (solve_with_techniques(&temp_grid, stats)) {
-            copy_grid(&temp_grid, grid);
-            return 1;
+        if (apply_constraint_propagation(&node->grid, &stats)) {
+            if (++found >= limit) break;
+        } else if (find_best_cell(&node->grid, &row, &col)) {
+            node->row = row;
+            node->col = col;
+            node->count = order_values(&node->grid, row, col, &plain, NULL, &stats, node->values);
+            node->next = 0;
+            stack->top++;
         }
+        
+        while (stack->top > 0 && nodes[stack->top - 1].next == nodes[stack->top - 1].count) {
+            stack->top--;
+        }
+        if (stack->top == 0) break;
+        
+        SearchNode *parent = &nodes[stack->top - 1];
+        int num = parent->values[parent->next++];
+        SudokuGrid *child = &nodes[stack->top].grid;
+        copy_grid(&parent->grid, child);
+        child->cells[parent->row][parent->col] = num;
+        child->empty_cells--;
+        update_candidates(child, parent->row, parent->col, num);
     }
     
-    return 0;
+    search_stack_free(stack);
+    return found;
 }
 
 // Serial version - just regular backtracking with constraint propagation
-int solve_serial(SudokuGrid *grid, SolverStats *stats) {
+int solve_serial(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
     memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
     stats->thread_id = 0;
     
     double start = omp_get_wtime();
+    SolveBudget budget;
+    SearchConfig config = search_config;
+    config.budget = budget_init(&budget, limits, start);
+    config.tt = open_transpositions(&config);
+    
     init_candidates(grid);
-    int result = solve_with_techniques(grid, stats);
+    config.nogood_store = open_nogoods(&config, grid);
+    int result = solve_with_config(grid, stats, &config);
+    tt_free(config.tt);
+    nogood_free(config.nogood_store);
     stats->time_taken = omp_get_wtime() - start;
+    stats->search_time = stats->time_taken;
+    stats->threads_used = 1;
     
     return result;
 }
 
+// ========== Parallel Time Accounting ==========
+// Each thread adds up how it spent its time so the scaling report can split
+// threads * wall time into useful search, redundant search, sync and idle.
+
+// Add a search interval; whatever ran past the moment the puzzle was solved
+// (by anyone) was redundant
+static void account_search(SolverStats *stats, double from, double to, double *solved_at) {
+    double t;
+    #pragma omp atomic read
+    t = *solved_at;
+    stats->search_time += to - from;
+    if (t > 0 && to > t) {
+        stats->redundant_time += to - (from > t ? from : t);
+    }
+}
+
+static void mark_solved(double *solved_at) {
+    #pragma omp atomic write
+    *solved_at = omp_get_wtime();
+}
+
+static void finish_accounting(SolverStats *stats, int threads) {
+    double idle = threads * stats->time_taken - stats->search_time - stats->sync_time;
+    stats->threads_used = threads;
+    stats->idle_time = idle > 0 ? idle : 0;
+}
+
+// ========== Ordered Cancellation ==========
+// V1 and V2 split the root into branches, one per candidate, in DFS order.
+// Normally the first branch to finish wins and cancels everyone. In
+// deterministic mode a solution in branch i only cancels the branches to its
+// right - the ones to the left may still hold the leftmost solution - so the
+// result and the counted work don't depend on thread count or timing.
+
+// Call inside a critical section. Returns 1 if branch i's solution is the
+// one to keep (so far).
+static int claim_solution(int i, int num_branches, int *first_solved, int *cancel, int deterministic) {
+    if (deterministic ? i >= *first_solved : *first_solved < num_branches) {
+        return 0;
+    }
+    *first_solved = i;
+    for (int j = 0; j < num_branches; j++) {
+        if (!deterministic || j > i) cancel[j] = 1;
+    }
+    return 1;
+}
+
+// Deterministic mode counts the branches up to the winner only: everything to
+// the right was cancelled at a timing-dependent point. Their thread time is
+// still added so the time breakdown stays complete.
+static void merge_branch_stats(SolverStats *branches, int count, int first_solved,
+                               int deterministic, SolverStats *stats) {
+    int keep = deterministic && first_solved < count ? first_solved + 1 : count;
+    aggregate_stats(branches, keep, stats);
+    for (int j = keep; j < count; j++) {
+        stats->search_time += branches[j].search_time;
+        stats->redundant_time += branches[j].redundant_time;
+        stats->sync_time += branches[j].sync_time;
+    }
+}
+
 // ========== Parallel Version 1: OpenMP Tasks ==========
 // This uses work stealing - idle threads grab work from busy ones
 
-int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth) {
+int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth,
+                             const SearchConfig *config, volatile int *stop) {
+    double entered = omp_get_wtime();
     stats->nodes_explored++;
     
-    // Try constraint propagation first
-    if (apply_constraint_propagation(grid, stats)) {
+    // Try constraint propagation first, at the level and with the cell
+    // order the run asked for
+    if (apply_propagation_level(grid, stats, config)) {
         return 1;
     }
     
     int row, col;
-    if (!find_best_cell(grid, &row, &col)) {
+    unsigned int rng = config->seed ? config->seed : 1;
+    if (!select_branch_cell(grid, config, &rng, stats, &row, &col)) {
         return 0;  // no solution
     }
     
@@ -495,22 +1403,37 @@ int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth) {
     // Only parallelize near the top of the search tree (depth < 2)
     // Otherwise overhead kills performance
     if (depth < 2 && num_cands > 2) {
-        int solved = 0;
+        int first_solved = num_cands;   // leftmost branch with a solution so far
+        int cancel[N] = {0};
+        SolverStats branch_stats[N] = {0};
         SudokuGrid solution;
+        double solved_at = 0;
+        double sync_time = 0;
+        int team_size = 1;
+        double region_start = omp_get_wtime();
         
-        #pragma omp parallel shared(solved, solution)
+        #pragma omp parallel shared(first_solved, cancel, branch_stats, solution, solved_at, sync_time, team_size)
         {
+            double startup = omp_get_wtime() - region_start;
+            #pragma omp atomic
+            sync_time += startup;
+            #pragma omp single nowait
+            team_size = omp_get_num_threads();
+            
             #pragma omp single
             {
-                for (int i = 0; i < num_cands && !solved; i++) {
+                for (int i = 0; i < num_cands && first_solved == num_cands; i++) {
                     int num = get_candidate(cands, i);
+                    int spawner = omp_get_thread_num();
                     
-                    #pragma omp task shared(solved, solution) firstprivate(num, row, col, i)
+                    #pragma omp task shared(first_solved, cancel, branch_stats, solution, solved_at) firstprivate(num, row, col, i, spawner)
                     {
-                        if (!solved) {
+                        if (omp_get_thread_num() != spawner) TRACE_EVENT(TRACE_STEAL, spawner);
+                        if (!cancel[i] && !search_cancelled(config, stop) && !out_of_budget(config)) {
                             SudokuGrid temp_grid;
-                            SolverStats local_stats = {0};
-                            local_stats.thread_id = omp_get_thread_num();
+                            SolverStats *local_stats = &branch_stats[i];
+                            local_stats->thread_id = omp_get_thread_num();
+                            double t0 = omp_get_wtime();
                             
                             #pragma omp critical
                             copy_grid(grid, &temp_grid);
@@ -519,21 +1442,30 @@ int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth) {
                             temp_grid.empty_cells--;
                             update_candidates(&temp_grid, row, col, num);
                             
-                            local_stats.backtrack_count++;
+                            local_stats->backtrack_count++;
                             
-                            if (solve_parallel_v1_helper(&temp_grid, &local_stats, depth + 1)) {
-                                #pragma omp critical
-                                {
-                                    if (!solved) {
-                                        copy_grid(&temp_grid, &solution);
-                                        stats->backtrack_count += local_stats.backtrack_count;
-                                        stats->nodes_explored += local_stats.nodes_explored;
-                                        stats->naked_singles_found += local_stats.naked_singles_found;
-                                        stats->hidden_singles_found += local_stats.hidden_singles_found;
-                                        solved = 1;
-                                    }
+                            // The branch polls its own flag and ours, so
+                            // cancelling this level reaches the deepest search
+                            SearchConfig branch_config = *config;
+                            branch_config.outer_stop = stop;
+                            int found = solve_parallel_v1_helper(&temp_grid, local_stats, depth + 1,
+                                                                 &branch_config, &cancel[i]);
+                            double t1 = omp_get_wtime();
+                            if (depth == 0) {
+                                account_search(local_stats, t0, t1, &solved_at);
+                            }
+                            
+                            #pragma omp critical
+                            {
+                                if (found == 1 && claim_solution(i, num_cands, &first_solved, cancel,
+                                                                 config->deterministic)) {
+                                    copy_grid(&temp_grid, &solution);
+                                    mark_solved(&solved_at);
                                 }
                             }
+                            double waited = omp_get_wtime() - t1;
+                            #pragma omp atomic
+                            sync_time += waited;
                         }
                     }
                 }
@@ -541,12 +1473,27 @@ int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth) {
             }
         }
         
-        if (solved) {
+        // Losing tasks count too: their nodes were real work
+        merge_branch_stats(branch_stats, num_cands, first_solved, config->deterministic, stats);
+        
+        // Only the outermost region runs a real team; nested ones are
+        // inactive and their time is already inside the enclosing task's
+        if (depth == 0) {
+            stats->search_time += region_start - entered;  // propagation before the split
+            stats->sync_time += sync_time;
+            stats->threads_used = team_size;
+        }
+        
+        if (first_solved < num_cands) {
             copy_grid(&solution, grid);
             return 1;
         }
+        if (out_of_budget(config)) {
+            return SEARCH_OVER_BUDGET;
+        }
     } else {
         // Serial solving for deeper levels
+        SearchStack *stack = search_stack_create();
         for (int i = 0; i < num_cands; i++) {
             int num = get_candidate(cands, i);
             
@@ -559,61 +1506,116 @@ int solve_parallel_v1_helper(SudokuGrid *grid, SolverStats *stats, int depth) {
             
             stats->backtrack_count++;
             
-            if (solve_with_techniques(&temp_grid, stats)) {
+            int result = solve_iterative(stack, &temp_grid, stats, config, stop);
+            if (result == 1) {
                 copy_grid(&temp_grid, grid);
-                return 1;
             }
+            if (result != 0) {
+                search_stack_free(stack);
+                return result;
+            }
+            if (search_cancelled(config, stop)) break;
         }
+        search_stack_free(stack);
     }
     
     return 0;
 }
 
-int solve_parallel_v1(SudokuGrid *grid, SolverStats *stats) {
+int solve_parallel_v1(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
     memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
     
     double start = omp_get_wtime();
+    SolveBudget budget;
+    SearchConfig config = search_config;
+    config.budget = budget_init(&budget, limits, start);
+    config.tt = open_transpositions(&config);
+    
     init_candidates(grid);
-    int result = solve_parallel_v1_helper(grid, stats, 0);
+    // Nogoods are relative to the grid the helper branches from, so propagate
+    // before rooting the store (the helper's own pass then has nothing left)
+    int result = apply_propagation_level(grid, stats, &config);
+    stats->search_time += omp_get_wtime() - start;
+    if (!result) {
+        config.nogood_store = open_nogoods(&config, grid);
+        result = solve_parallel_v1_helper(grid, stats, 0, &config, NULL);
+    }
+    tt_free(config.tt);
+    nogood_free(config.nogood_store);
     stats->time_taken = omp_get_wtime() - start;
+    stats->timed_out = result == SOLVE_TIMED_OUT;
+    
+    if (stats->threads_used == 0) {
+        // Never split at the root, so it all ran on this thread
+        stats->search_time = stats->time_taken;
+        stats->threads_used = 1;
+    }
+    finish_accounting(stats, stats->threads_used);
     
     return result;
 }
 
 // ========== Parallel Version 2: Speculative Parallel For ==========
 
-int solve_parallel_v2(SudokuGrid *grid, SolverStats *stats) {
+int solve_parallel_v2(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
     memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
     
     double start = omp_get_wtime();
+    SolveBudget budget;
+    SolveBudget *shared_budget = budget_init(&budget, limits, start);
     init_candidates(grid);
     
-    // Try constraint propagation first
-    if (apply_constraint_propagation(grid, stats)) {
+    // Try constraint propagation first, configured like the workers' search
+    if (apply_propagation_level(grid, stats, &search_config)) {
         stats->time_taken = omp_get_wtime() - start;
+        stats->search_time = stats->time_taken;
+        stats->threads_used = 1;
         return 1;
     }
     
     int row, col;
-    if (!find_best_cell(grid, &row, &col)) {
+    unsigned int rng = search_config.seed ? search_config.seed : 1;
+    if (!select_branch_cell(grid, &search_config, &rng, stats, &row, &col)) {
         stats->time_taken = omp_get_wtime() - start;
+        stats->search_time = stats->time_taken;
+        stats->threads_used = 1;
         return 0;
     }
     
     CandidateSet cands = grid->candidates[row][col];
     int num_cands = count_candidates(cands);
     
-    int solved = 0;
+    int first_solved = num_cands;   // leftmost branch with a solution so far
+    int cancel[N] = {0};
     SudokuGrid solution;
-    SolverStats local_stats[MAX_THREADS] = {0};
-    
-    #pragma omp parallel shared(solved, solution, local_stats)
+    SolverStats branch_stats[N] = {0};          // search counters, per branch
+    SolverStats local_stats[MAX_THREADS] = {0}; // thread time, per thread
+    int num_threads = omp_get_max_threads();
+    if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+    double solved_at = 0;
+    TranspositionTable *tt = open_transpositions(&search_config);
+    NogoodStore *nogoods = open_nogoods(&search_config, grid);  // relative to the propagated root
+    double region_start = omp_get_wtime();
+    stats->search_time = region_start - start;  // root propagation, master only
+    
+    #pragma omp parallel num_threads(num_threads) shared(first_solved, cancel, solution, branch_stats, local_stats, solved_at)
     {
         int tid = omp_get_thread_num();
+        local_stats[tid].sync_time += omp_get_wtime() - region_start;
+        SearchStack *stack = search_stack_create();  // one per worker, reused
+        SearchConfig config = search_config;
+        config.seed += tid;  // different random stream per worker
+        config.budget = shared_budget;
+        config.tt = tt;
+        config.nogood_store = nogoods;
         
         #pragma omp for schedule(dynamic, 1)
         for (int i = 0; i < num_cands; i++) {
-            if (!solved) {
+            if (!cancel[i] && !out_of_budget(&config)) {
                 int num = get_candidate(cands, i);
                 
                 SudokuGrid temp_grid;
@@ -623,44 +1625,64 @@ int solve_parallel_v2(SudokuGrid *grid, SolverStats *stats) {
                 temp_grid.empty_cells--;
                 update_candidates(&temp_grid, row, col, num);
                 
-                local_stats[tid].backtrack_count++;
+                // Deterministic runs seed by branch, so a branch searches the
+                // same way whichever thread gets it
+                if (config.deterministic) config.seed = search_config.seed + i;
+                branch_stats[i].backtrack_count++;
+                branch_stats[i].thread_id = tid;
                 local_stats[tid].thread_id = tid;
                 
-                if (solve_with_techniques(&temp_grid, &local_stats[tid])) {
+                double t0 = omp_get_wtime();
+                int found = solve_iterative(stack, &temp_grid, &branch_stats[i], &config, &cancel[i]);
+                double t1 = omp_get_wtime();
+                account_search(&local_stats[tid], t0, t1, &solved_at);
+                
+                if (found == 1) {
                     #pragma omp critical
                     {
-                        if (!solved) {
+                        if (claim_solution(i, num_cands, &first_solved, cancel, config.deterministic)) {
                             copy_grid(&temp_grid, &solution);
-                            solved = 1;
+                            mark_solved(&solved_at);
                         }
                     }
+                    local_stats[tid].sync_time += omp_get_wtime() - t1;
                 }
             }
         }
+        
+        search_stack_free(stack);
     }
     
+    tt_free(tt);
+    nogood_free(nogoods);
+    
     // Aggregate statistics
-    for (int i = 0; i < omp_get_max_threads(); i++) {
-        stats->backtrack_count += local_stats[i].backtrack_count;
-        stats->nodes_explored += local_stats[i].nodes_explored;
-        stats->naked_singles_found += local_stats[i].naked_singles_found;
-        stats->hidden_singles_found += local_stats[i].hidden_singles_found;
-    }
+    merge_branch_stats(branch_stats, num_cands, first_solved, search_config.deterministic, stats);
+    aggregate_stats(local_stats, num_threads, stats);
     
+    int solved = first_solved < num_cands;
     if (solved) {
         copy_grid(&solution, grid);
+    } else if (shared_budget && shared_budget->expired) {
+        stats->timed_out = 1;  // grid is still the propagated root
     }
     
     stats->time_taken = omp_get_wtime() - start;
-    return solved;
+    finish_accounting(stats, num_threads);
+    return stats->timed_out ? SOLVE_TIMED_OUT : solved;
 }
 
 // ========== Parallel Version 3: Hybrid Approach ==========
 
-int solve_parallel_v3(SudokuGrid *grid, SolverStats *stats) {
+int solve_parallel_v3(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
     memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
     
     double start = omp_get_wtime();
+    SolveBudget budget;
+    SearchConfig config = search_config;
+    config.budget = budget_init(&budget, limits, start);
     init_candidates(grid);
     
     // Estimate difficulty and choose strategy
@@ -668,13 +1690,336 @@ int solve_parallel_v3(SudokuGrid *grid, SolverStats *stats) {
     
     if (difficulty < 100) {
         // Easy puzzle - use serial with techniques
-        int result = solve_with_techniques(grid, stats);
+        config.tt = open_transpositions(&config);
+        config.nogood_store = open_nogoods(&config, grid);
+        int result = solve_with_config(grid, stats, &config);
+        tt_free(config.tt);
+        nogood_free(config.nogood_store);
         stats->time_taken = omp_get_wtime() - start;
+        stats->search_time = stats->time_taken;
+        stats->threads_used = 1;
         return result;
     } else {
-        // Hard puzzle - use parallel approach
-        return solve_parallel_v2(grid, stats);
+        // Hard puzzle - race different search configurations. The portfolio
+        // starts its own clock, so take off what the estimate already used.
+        SolveLimits remaining = { 0, 0 };
+        if (limits) {
+            remaining = *limits;
+            if (remaining.time_limit > 0) {
+                remaining.time_limit -= omp_get_wtime() - start;
+                if (remaining.time_limit <= 0) remaining.time_limit = 1e-9;
+            }
+        }
+        // A race has no leftmost solution, so deterministic runs split the
+        // tree in order instead
+        if (search_config.deterministic) {
+            return solve_parallel_v2(grid, stats, &remaining);
+        }
+        return solve_parallel_portfolio(grid, stats, &remaining);
+    }
+}
+
+// ========== Portfolio: Race Different Configurations ==========
+// Splitting one deterministic tree can't beat a lucky heuristic on a
+// heavy-tailed puzzle, so every thread searches the whole tree its own way
+// and the first one done cancels the others.
+
+static const SearchConfig portfolio[] = {
+    { .cell_order = CELL_MRV,        .value_order = VALUE_ASCENDING, .seed = 1,
+      .propagation = PROPAGATE_ALL,     .subset_size = 2 },
+    { .cell_order = CELL_MRV_DEGREE, .value_order = VALUE_LCV,       .seed = 1,
+      .propagation = PROPAGATE_ALL,     .subset_size = 2 },
+    { .cell_order = CELL_MRV,        .value_order = VALUE_FREQUENCY, .seed = 1,
+      .propagation = PROPAGATE_ALL,     .subset_size = 4 },
+    { .cell_order = CELL_MRV_DEGREE, .value_order = VALUE_RANDOM,    .seed = 1,
+      .propagation = PROPAGATE_ALL,     .subset_size = 2, .restart_nodes = RESTART_BASE_NODES },
+    { .cell_order = CELL_MRV_DEGREE, .value_order = VALUE_FREQUENCY, .seed = 1,
+      .propagation = PROPAGATE_SINGLES, .subset_size = 2 },
+    { .cell_order = CELL_MRV,        .value_order = VALUE_RANDOM,    .seed = 1,
+      .propagation = PROPAGATE_SINGLES, .subset_size = 2, .restart_nodes = RESTART_BASE_NODES },
+};
+#define PORTFOLIO_SIZE ((int)(sizeof(portfolio) / sizeof(portfolio[0])))
+
+// Config for thread tid. Threads past the end of the table get randomized
+// restarting variants, since another copy of a deterministic entry is wasted.
+static SearchConfig portfolio_config(int tid) {
+    SearchConfig config = portfolio[tid % PORTFOLIO_SIZE];
+    config.seed = search_config.seed + tid;
+    if (tid >= PORTFOLIO_SIZE) {
+        config.value_order = VALUE_RANDOM;
+        config.restart_nodes = RESTART_BASE_NODES;
     }
+    return config;
+}
+
+int solve_parallel_portfolio(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
+    memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
+    
+    double start = omp_get_wtime();
+    SolveBudget budget;
+    SolveBudget *shared_budget = budget_init(&budget, limits, start);
+    TranspositionTable *tt = open_transpositions(&search_config);
+    init_candidates(grid);
+    NogoodStore *nogoods = open_nogoods(&search_config, grid);
+    
+    int solved = 0;
+    int winner = -1;
+    SudokuGrid solution;
+    SolverStats local_stats[MAX_THREADS] = {0};
+    int num_threads = omp_get_max_threads();
+    if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+    double solved_at = 0;
+    double region_start = omp_get_wtime();
+    
+    #pragma omp parallel num_threads(num_threads) shared(solved, winner, solution, local_stats, solved_at)
+    {
+        int tid = omp_get_thread_num();
+        local_stats[tid].sync_time += omp_get_wtime() - region_start;
+        SearchConfig config = portfolio_config(tid);
+        config.budget = shared_budget;
+        config.tt = tt;  // dead is dead whatever heuristics found it
+        config.nogood_store = nogoods;
+        SearchStack *stack = search_stack_create();
+        
+        SudokuGrid temp_grid;
+        copy_grid(grid, &temp_grid);
+        local_stats[tid].thread_id = tid;
+        
+        double t0 = omp_get_wtime();
+        int found = solve_iterative(stack, &temp_grid, &local_stats[tid], &config, &solved);
+        double t1 = omp_get_wtime();
+        account_search(&local_stats[tid], t0, t1, &solved_at);
+        
+        if (found == 1) {
+            #pragma omp critical
+            {
+                if (!solved) {
+                    copy_grid(&temp_grid, &solution);
+                    mark_solved(&solved_at);
+                    winner = tid;
+                    solved = 1;
+                }
+            }
+            local_stats[tid].sync_time += omp_get_wtime() - t1;
+        }
+        
+        search_stack_free(stack);
+    }
+    
+    tt_free(tt);
+    nogood_free(nogoods);
+    
+    // Total work of all threads, including the ones that got cancelled
+    aggregate_stats(local_stats, num_threads, stats);
+    stats->thread_id = winner;
+    
+    if (solved) {
+        copy_grid(&solution, grid);
+    } else if (shared_budget && shared_budget->expired) {
+        // Every thread copied the root before searching, so propagate it here
+        SolverStats unused = {0};
+        apply_constraint_propagation(grid, &unused);
+        stats->timed_out = 1;
+    }
+    
+    stats->time_taken = omp_get_wtime() - start;
+    finish_accounting(stats, num_threads);
+    return stats->timed_out ? SOLVE_TIMED_OUT : solved;
+}
+
+// ========== Batch Hybrid: Inter- and Intra-Puzzle Parallelism ==========
+// Most puzzles in a batch are easy, so one thread per puzzle is the cheapest
+// way to keep everyone busy. But one hard puzzle would then set the makespan
+// on its own. Each puzzle gets node_budget nodes on a single thread; if it
+// runs out, the untried branches on its stack are handed out as tasks that
+// idle threads pick up (and those split again if they run out too).
+
+static void hybrid_search(SudokuGrid *start, SudokuGrid *target, int *done,
+                          const SearchConfig *config, SolverStats *thread_stats) {
+    SolverStats *stats = &thread_stats[omp_get_thread_num()];
+    SearchStack *stack = search_stack_create();
+    SudokuGrid grid;
+    SolverStats before = *stats;
+    copy_grid(start, &grid);
+    
+    double t0 = omp_get_wtime();
+    int result = solve_iterative(stack, &grid, stats, config, done);
+    stats->search_time += omp_get_wtime() - t0;
+    metrics_record_work(stats, &before, omp_get_thread_num(), omp_get_wtime() - t0);
+    if (result == 1) {
+        int first = 0;
+        #pragma omp critical
+        {
+            if (!*done) {
+                copy_grid(&grid, target);
+                *done = 1;
+                first = 1;
+            }
+        }
+        if (first) metrics_record_puzzle(1, -1);
+    } else if (result == SEARCH_OVER_BUDGET) {
+        stats->budget_splits++;
+        SudokuGrid branch;
+        while (search_stack_steal(stack, &branch)) {
+            #pragma omp task firstprivate(branch)
+            hybrid_search(&branch, target, done, config, thread_stats);
+        }
+    }
+    
+    search_stack_free(stack);
+}
+
+// Solves puzzles[0..count) in place, results[i] = 1 if puzzle i was solved.
+// node_budget 0 never splits (plain one-thread-per-puzzle). stats gets the
+// total work and the makespan; returns the number of puzzles solved.
+int solve_batch_hybrid(SudokuGrid *puzzles, int count, int *results, SolverStats *stats,
+                       unsigned long long node_budget) {
+    memset(stats, 0, sizeof(SolverStats));
+    PROFILE_RESET();
+    TRACE_RESET();
+    
+    double start = omp_get_wtime();
+    SolverStats thread_stats[MAX_THREADS] = {0};
+    SearchConfig config = search_config;
+    config.node_limit = node_budget;
+    int num_threads = omp_get_max_threads();
+    if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+    
+    metrics_start();
+    for (int i = 0; i < count; i++) {
+        results[i] = 0;
+        init_candidates(&puzzles[i]);
+    }
+    
+    #pragma omp parallel num_threads(num_threads)
+    {
+        #pragma omp single
+        {
+            for (int i = 0; i < count; i++) {
+                #pragma omp task firstprivate(i)
+                {
+                    hybrid_search(&puzzles[i], &puzzles[i], &results[i], &config, thread_stats);
+                }
+            }
+        }
+    }
+    
+    aggregate_stats(thread_stats, num_threads, stats);
+    stats->time_taken = omp_get_wtime() - start;
+    finish_accounting(stats, num_threads);
+    
+    int solved = 0;
+    for (int i = 0; i < count; i++) {
+        if (!results[i]) metrics_record_puzzle(0, -1);
+        solved += results[i];
+    }
+    return solved;
+}
+
+// ========== Technique Rating ==========
+// Solves like a person would: always the easiest technique that still makes
+// progress, back to the easiest one after every step. The rating is the
+// hardest technique that was needed (SE-style weights); whatever the whole
+// ladder can't crack goes to the search, rated by its node count.
+
+static const char *rating_names[RATE_LEVELS] = {
+    "hidden_single", "naked_single", "locked_candidates", "pair", "xwing",
+    "triple", "swordfish", "xy_wing", "quad", "search"
+};
+static const double rating_weights[RATE_LEVELS] = { 1.5, 2.3, 2.6, 3.0, 3.2, 3.6, 3.8, 4.2, 5.0, 6.0 };
+
+const char *rating_level_name(int level) {
+    return level >= 0 && level < RATE_LEVELS ? rating_names[level] : "none";
+}
+
+static int apply_rating_level(SudokuGrid *grid, SolverStats *stats, int level) {
+    switch (level) {
+        case RATE_HIDDEN_SINGLE: return apply_hidden_singles(grid, stats);
+        case RATE_NAKED_SINGLE:  return apply_naked_singles(grid, stats);
+        case RATE_LOCKED:        return apply_pointing_pairs(grid, stats);
+        case RATE_PAIR:          return apply_subsets(grid, stats, 2);
+        case RATE_XWING:         return apply_fish(grid, stats, 2);
+        case RATE_TRIPLE:        return apply_subsets(grid, stats, 3);
+        case RATE_SWORDFISH:     return apply_fish(grid, stats, 3);
+        case RATE_XY_WING:       return apply_xy_wing(grid, stats);
+        case RATE_QUAD:          return apply_subsets(grid, stats, 4);
+    }
+    return 0;
+}
+
+int rate_puzzle(SudokuGrid *grid, PuzzleRating *rating) {
+    static const SearchConfig everything = { .cell_order = CELL_MRV, .value_order = VALUE_ASCENDING, .seed = 1,
+                                             .propagation = PROPAGATE_ALL, .subset_size = MAX_SUBSET_SIZE,
+                                             .extra_techniques = EXTRA_XWING | EXTRA_SWORDFISH | EXTRA_XY_WING };
+    SolverStats stats = {0};
+    memset(rating, 0, sizeof(PuzzleRating));
+    rating->hardest = -1;
+    
+    if (!check_givens(grid)) {
+        rating->result = RESULT_INVALID;
+        return RESULT_INVALID;
+    }
+    init_candidates(grid);
+    
+    int level = 0;
+    while (grid->empty_cells > 0 && level < RATE_SEARCH) {
+        if (apply_rating_level(grid, &stats, level)) {
+            rating->steps++;
+            rating->level_steps[level]++;
+            if (level > rating->hardest) rating->hardest = level;
+            level = 0;
+        } else {
+            level++;
+        }
+    }
+    
+    if (grid->empty_cells > 0) {
+        // Stuck - the search from here uses every technique at every node,
+        // so its node count is what the ladder was missing
+        rating->hardest = RATE_SEARCH;
+        rating->result = solve_with_config(grid, &stats, &everything);
+        rating->search_nodes = stats.nodes_explored;
+    } else {
+        rating->result = verify_solution(grid);
+    }
+    
+    if (rating->hardest == RATE_SEARCH) {
+        // Half a point per doubling of the nodes
+        int doublings = rating->search_nodes ? 63 - __builtin_clzll(rating->search_nodes) : 0;
+        rating->score = rating_weights[RATE_SEARCH] + 0.5 * doublings;
+    } else if (rating->hardest >= 0) {
+        rating->score = rating_weights[rating->hardest];
+    }
+    return rating->result;
+}
+
+// One puzzle per iteration, dynamic because the search fallback makes a few
+// puzzles far slower than the rest
+void rate_batch(SudokuGrid *puzzles, int count, PuzzleRating *ratings) {
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (int i = 0; i < count; i++) {
+        rate_puzzle(&puzzles[i], &ratings[i]);
+    }
+}
+
+// ========== Engine Table ==========
+
+const SolverEngine solver_engines[NUM_ENGINES] = {
+    { "serial",    solve_serial,             0 },
+    { "v1",        solve_parallel_v1,        1 },
+    { "v2",        solve_parallel_v2,        1 },
+    { "v3",        solve_parallel_v3,        1 },
+    { "portfolio", solve_parallel_portfolio, 1 },
+    { "bitboard",  solve_bitboard,           0 },
+};
+
+const SolverEngine *find_engine(const char *name) {
+    for (int e = 0; e < NUM_ENGINES; e++) {
+        if (strcmp(name, solver_engines[e].name) == 0) return &solver_engines[e];
+    }
+    return NULL;
 }
 
 // ========== Verification ==========
@@ -717,6 +2062,24 @@ int verify_solution(SudokuGrid *grid) {
     return 1;
 }
 
+// 1 if no two givens share a row, column or box. The engines assume that
+// and can search for a very long time on a grid that breaks it.
+int check_givens(SudokuGrid *grid) {
+    unsigned short used[NUM_UNITS] = {0};
+    int *cells = &grid->cells[0][0];
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        if (cells[cell] == UNASSIGNED) continue;
+        if (cells[cell] < 1 || cells[cell] > 9) return 0;
+        unsigned short bit = 1 << (cells[cell] - 1);
+        for (int u = 0; u < 3; u++) {
+            int unit = cell_units[cell][u];
+            if (used[unit] & bit) return 0;
+            used[unit] |= bit;
+        }
+    }
+    return 1;
+}
+
 // ========== I/O Functions ==========
 
 void load_puzzle(const char *filename, SudokuGrid *grid) {
@@ -728,21 +2091,89 @@ void load_puzzle(const char *filename, SudokuGrid *grid) {
         exit(1);
     }
     
-    grid->empty_cells = 0;
-    for (int i = 0; i < N; i++) {
-        for (int j = 0; j < N; j++) {
-            if (fscanf(file, "%d", &grid->cells[i][j]) != 1) {
-                printf("Error: Invalid puzzle format\n");
-                fclose(file);
-                exit(1);
-            }
-            if (grid->cells[i][j] == UNASSIGNED) {
-                grid->empty_cells++;
-            }
+    grid->empty_cells = 0;
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            if (fscanf(file, "%d", &grid->cells[i][j]) != 1) {
+                printf("Error: Invalid puzzle format\n");
+                fclose(file);
+                exit(1);
+            }
+            if (grid->cells[i][j] == UNASSIGNED) {
+                grid->empty_cells++;
+            }
+        }
+    }
+    
+    fclose(file);
+}
+
+// One puzzle per line, the format the public puzzle collections use:
+// 81 characters, digits for clues and '0' or '.' for empty cells.
+// Anything after the 81st character (ratings, comments) is ignored.
+int parse_puzzle_line(const char *line, SudokuGrid *grid) {
+    init_grid(grid);
+    grid->empty_cells = 0;
+    
+    int *cells = &grid->cells[0][0];
+    for (int k = 0; k < N * N; k++) {
+        char ch = line[k];
+        if (ch >= '1' && ch <= '9') {
+            cells[k] = ch - '0';
+        } else if (ch == '0' || ch == '.') {
+            cells[k] = UNASSIGNED;
+            grid->empty_cells++;
+        } else {
+            return 0;  // too short or bad character
+        }
+    }
+    return 1;
+}
+
+// line needs room for 82 chars (81 + terminator)
+void format_puzzle_line(SudokuGrid *grid, char *line) {
+    int *cells = &grid->cells[0][0];
+    for (int k = 0; k < N * N; k++) {
+        line[k] = cells[k] ? '0' + cells[k] : '.';
+    }
+    line[N * N] = '\0';
+}
+
+// Load every puzzle from a one-per-line file. Blank lines and lines starting
+// with '#' are skipped. *grids is malloc'd, returns the number of puzzles.
+int load_puzzle_batch(const char *filename, SudokuGrid **grids) {
+    FILE *file = fopen(filename, "r");
+    if (!file) {
+        printf("Error: Could not open file %s\n", filename);
+        exit(1);
+    }
+    
+    int count = 0, capacity = 1024, line_no = 0;
+    *grids = malloc(capacity * sizeof(SudokuGrid));
+    char line[256];
+    
+    while (fgets(line, sizeof(line), file)) {
+        line_no++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+        
+        if (count == capacity) {
+            capacity *= 2;
+            *grids = realloc(*grids, capacity * sizeof(SudokuGrid));
+        }
+        if (!*grids) {
+            printf("Error: Out of memory loading %s\n", filename);
+            exit(1);
+        }
+        
+        if (parse_puzzle_line(line, &(*grids)[count])) {
+            count++;
+        } else {
+            printf("Warning: %s:%d is not a puzzle, skipped\n", filename, line_no);
         }
     }
     
     fclose(file);
+    return count;
 }
 
 void print_grid(SudokuGrid *grid) {
@@ -780,6 +2211,40 @@ void print_candidates(SudokuGrid *grid) {
     }
 }
 
+// Add the counters of count per-thread stats into result (time is left alone)
+void aggregate_stats(SolverStats *stats_array, int count, SolverStats *result) {
+    for (int i = 0; i < count; i++) {
+        SolverStats *s = &stats_array[i];
+        result->backtrack_count += s->backtrack_count;
+        result->naked_singles_found += s->naked_singles_found;
+        result->hidden_singles_found += s->hidden_singles_found;
+        for (int k = 0; k <= MAX_SUBSET_SIZE; k++) {
+            result->naked_subsets[k] += s->naked_subsets[k];
+            result->hidden_subsets[k] += s->hidden_subsets[k];
+        }
+        result->pointing_pairs_found += s->pointing_pairs_found;
+        result->box_line_reductions += s->box_line_reductions;
+        result->xwing_eliminations += s->xwing_eliminations;
+        result->swordfish_eliminations += s->swordfish_eliminations;
+        result->xy_wing_eliminations += s->xy_wing_eliminations;
+        result->nodes_explored += s->nodes_explored;
+        result->degree_tiebreaks += s->degree_tiebreaks;
+        result->lcv_orderings += s->lcv_orderings;
+        result->frequency_orderings += s->frequency_orderings;
+        result->random_orderings += s->random_orderings;
+        result->restarts += s->restarts;
+        result->budget_splits += s->budget_splits;
+        result->tt_hits += s->tt_hits;
+        result->tt_stores += s->tt_stores;
+        result->nogoods_learned += s->nogoods_learned;
+        result->nogood_prunes += s->nogood_prunes;
+        result->nogood_eliminations += s->nogood_eliminations;
+        result->search_time += s->search_time;
+        result->redundant_time += s->redundant_time;
+        result->sync_time += s->sync_time;
+    }
+}
+
 void print_stats(SolverStats *stats, const char *version) {
     printf("=== %s ===\n", version);
     printf("Time taken: %.6f seconds\n", stats->time_taken);
@@ -787,13 +2252,356 @@ void print_stats(SolverStats *stats, const char *version) {
     printf("Backtracks: %llu\n", stats->backtrack_count);
     printf("Naked singles: %llu\n", stats->naked_singles_found);
     printf("Hidden singles: %llu\n", stats->hidden_singles_found);
-    printf("Naked pairs: %llu\n", stats->naked_pairs_found);
+    printf("Naked subsets:");
+    for (int k = 2; k <= MAX_SUBSET_SIZE; k++) printf(" %llu", stats->naked_subsets[k]);
+    printf("  Hidden subsets:");
+    for (int k = 2; k <= MAX_SUBSET_SIZE; k++) printf(" %llu", stats->hidden_subsets[k]);
+    printf("  (eliminations, size 2..%d)\n", MAX_SUBSET_SIZE);
     printf("Pointing pairs: %llu\n", stats->pointing_pairs_found);
+    if (stats->xwing_eliminations || stats->swordfish_eliminations || stats->xy_wing_eliminations) {
+        printf("Fish/wings: %llu X-Wing, %llu Swordfish, %llu XY-Wing eliminations\n",
+               stats->xwing_eliminations, stats->swordfish_eliminations, stats->xy_wing_eliminations);
+    }
+    if (stats->tt_stores) {
+        printf("Transpositions: %llu dead states stored, %llu duplicate states pruned\n",
+               stats->tt_stores, stats->tt_hits);
+    }
+    if (stats->nogoods_learned) {
+        printf("Nogoods: %llu learned, %llu nodes pruned, %llu candidates eliminated\n",
+               stats->nogoods_learned, stats->nogood_prunes, stats->nogood_eliminations);
+    }
+    if (stats->degree_tiebreaks || stats->lcv_orderings || stats->frequency_orderings ||
+        stats->random_orderings || stats->restarts) {
+        printf("Heuristics: %llu degree tie-breaks, %llu LCV / %llu frequency / %llu random orderings, %llu restarts\n",
+               stats->degree_tiebreaks, stats->lcv_orderings, stats->frequency_orderings,
+               stats->random_orderings, stats->restarts);
+    }
+    if (stats->timed_out) {
+        printf("TIMED OUT - partial result (deadline or node budget reached)\n");
+    }
+    if (stats->budget_splits) {
+        printf("Budget splits: %llu\n", stats->budget_splits);
+    }
+    if (stats->threads_used > 1) {
+        printf("Thread time: %.6fs search (%.6fs redundant), %.6fs sync, %.6fs idle over %d threads\n",
+               stats->search_time, stats->redundant_time, stats->sync_time,
+               stats->idle_time, stats->threads_used);
+    }
+    printf("\n");
+#ifdef SUDOKU_PROFILE
+    print_profile();
+#endif
+}
+
+// ========== Hardware Counter Profiling ==========
+
+#ifdef SUDOKU_PROFILE
+
+static ThreadProfile thread_profiles[MAX_THREADS];
+static int profile_threads = 0;     // slots handed out so far
+static int perf_unavailable = 0;    // set if any thread couldn't open counters
+
+// Per OS thread, so nested (inactive) parallel regions don't share a slot
+static int profile_slot = -1;
+static int perf_group_fd = -1;      // -1 = not opened yet, -2 = failed
+#pragma omp threadprivate(profile_slot, perf_group_fd)
+
+static const char *profile_section_names[PROF_SECTIONS] = {
+    "Naked singles", "Hidden singles", "Subsets", "Pointing pairs", "X-Wing", "Swordfish",
+    "XY-Wing", "Branching", "Grid copy"
+};
+
+// Open cycles/instructions/cache misses/branch misses as one group for the
+// calling thread, user space only (works with perf_event_paranoid <= 2)
+static int open_perf_group(void) {
+    static const unsigned long long events[PROF_COUNTERS - 1] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    int fds[PROF_COUNTERS - 1];
+    
+    for (int i = 0; i < PROF_COUNTERS - 1; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = events[i];
+        attr.disabled = (i == 0);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        
+        fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, i ? fds[0] : -1, 0);
+        if (fds[i] < 0) {
+            while (--i >= 0) close(fds[i]);
+            #pragma omp atomic write
+            perf_unavailable = 1;
+            return -2;
+        }
+    }
+    
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return fds[0];
+}
+
+void profile_reset(void) {
+    memset(thread_profiles, 0, sizeof(thread_profiles));
+}
+
+void profile_read(ProfileSample *sample) {
+    if (perf_group_fd == -1) {
+        perf_group_fd = open_perf_group();
+    }
+    
+    memset(sample, 0, sizeof(*sample));
+    if (perf_group_fd >= 0) {
+        unsigned long long buf[PROF_COUNTERS];  // nr, then one value per event
+        if (read(perf_group_fd, buf, sizeof(buf)) == sizeof(buf)) {
+            memcpy(&sample->value[PROF_CYCLES], &buf[1], sizeof(buf) - sizeof(buf[0]));
+        }
+    }
+    
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    sample->value[PROF_NS] = ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void profile_record(ProfileSection section, ProfileSample *start) {
+    ProfileSample now;
+    profile_read(&now);
+    
+    if (profile_slot < 0) {
+        #pragma omp atomic capture
+        profile_slot = profile_threads++;
+    }
+    if (profile_slot >= MAX_THREADS) return;
+    
+    ThreadProfile *p = &thread_profiles[profile_slot];
+    p->calls[section]++;
+    for (int c = 0; c < PROF_COUNTERS; c++) {
+        p->total[section][c] += now.value[c] - start->value[c];
+    }
+}
+
+static void print_profile_row(const char *name, unsigned long long calls, unsigned long long *t) {
+    double ipc = t[PROF_CYCLES] ? (double)t[PROF_INSTRUCTIONS] / t[PROF_CYCLES] : 0;
+    printf("  %-15s %10llu %10.1f %12llu %12llu %5.2f %10llu %10llu\n",
+           name, calls, t[PROF_NS] / 1000.0, t[PROF_CYCLES], t[PROF_INSTRUCTIONS], ipc,
+           t[PROF_CACHE_MISSES], t[PROF_BRANCH_MISSES]);
+}
+
+void print_profile(void) {
+    ThreadProfile total;
+    memset(&total, 0, sizeof(total));
+    
+    printf("--- Hardware counters ---\n");
+    if (perf_unavailable) {
+        printf("  (perf_event_open failed - only times are real, check /proc/sys/kernel/perf_event_paranoid)\n");
+    }
+    printf("  %-15s %10s %10s %12s %12s %5s %10s %10s\n",
+           "Section", "Calls", "Time(us)", "Cycles", "Instr", "IPC", "CacheMiss", "BranchMiss");
+    
+    int slots = profile_threads < MAX_THREADS ? profile_threads : MAX_THREADS;
+    for (int t = 0; t < slots; t++) {
+        ThreadProfile *p = &thread_profiles[t];
+        int used = 0;
+        for (int s = 0; s < PROF_SECTIONS; s++) used |= p->calls[s] != 0;
+        if (!used) continue;
+        
+        printf(" Thread %d:\n", t);
+        for (int s = 0; s < PROF_SECTIONS; s++) {
+            if (!p->calls[s]) continue;
+            print_profile_row(profile_section_names[s], p->calls[s], p->total[s]);
+            total.calls[s] += p->calls[s];
+            for (int c = 0; c < PROF_COUNTERS; c++) total.total[s][c] += p->total[s][c];
+        }
+    }
+    
+    printf(" All threads:\n");
+    for (int s = 0; s < PROF_SECTIONS; s++) {
+        print_profile_row(profile_section_names[s], total.calls[s], total.total[s]);
+    }
+    printf("\n");
+}
+
+#endif
+
+// ========== Search Trace ==========
+
+#ifdef SUDOKU_TRACE
+
+#define TRACE_RING_EVENTS (1 << 16)   // per thread, 1 MB
+#define TRACE_MAGIC "SDKTRACE"
+#define TRACE_VERSION 1
+
+typedef struct {
+    unsigned long long tsc;
+    unsigned int arg;
+    unsigned short thread;
+    unsigned char type;
+    unsigned char pad;
+} TraceEvent;
+
+typedef struct {
+    unsigned long long written;  // total events, the ring keeps the last TRACE_RING_EVENTS
+    TraceEvent events[TRACE_RING_EVENTS];
+} TraceRing;
+
+static TraceRing trace_rings[MAX_THREADS];
+static int trace_threads = 0;       // slots handed out so far
+static unsigned long long trace_start_tsc;
+static double trace_start_wall;
+
+// Per OS thread like the profiler's slot, so nested regions don't share a ring
+static int trace_slot = -1;
+#pragma omp threadprivate(trace_slot)
+
+static inline unsigned long long trace_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+// Only resets the write positions - old events are simply not exported
+void trace_reset(void) {
+    for (int t = 0; t < MAX_THREADS; t++) trace_rings[t].written = 0;
+    trace_start_wall = omp_get_wtime();
+    trace_start_tsc = trace_clock();
+}
+
+void trace_event(int type, unsigned int arg) {
+    if (trace_slot < 0) {
+        #pragma omp atomic capture
+        trace_slot = trace_threads++;
+    }
+    if (trace_slot >= MAX_THREADS) return;
+    
+    TraceRing *ring = &trace_rings[trace_slot];
+    TraceEvent *e = &ring->events[ring->written++ & (TRACE_RING_EVENTS - 1)];
+    e->tsc = trace_clock();
+    e->arg = arg;
+    e->thread = (unsigned short)trace_slot;
+    e->type = (unsigned char)type;
+    e->pad = 0;
+}
+
+// Binary layout (native endian):
+//   header: magic[8], u32 version, u32 threads, f64 ticks per us, u64 start tick, char puzzle[88]
+//   per thread: u32 thread, u32 pad, u64 events, u64 dropped, then the events oldest first
+void export_solving_trace(const char *filename, SudokuGrid *grid) {
+    // Calibrate ticks against the wall clock over the traced solve
+    double wall = omp_get_wtime() - trace_start_wall;
+    unsigned long long ticks = trace_clock() - trace_start_tsc;
+    double ticks_per_us = wall > 0 ? ticks / (wall * 1e6) : 1.0;
+    
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        printf("Error: Could not write trace to %s\n", filename);
+        return;
+    }
+    
+    char puzzle[88] = {0};
+    format_puzzle_line(grid, puzzle);
+    unsigned int version = TRACE_VERSION;
+    unsigned int threads = trace_threads < MAX_THREADS ? trace_threads : MAX_THREADS;
+    fwrite(TRACE_MAGIC, 1, 8, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&threads, sizeof(threads), 1, file);
+    fwrite(&ticks_per_us, sizeof(ticks_per_us), 1, file);
+    fwrite(&trace_start_tsc, sizeof(trace_start_tsc), 1, file);
+    fwrite(puzzle, 1, sizeof(puzzle), file);
+    
+    unsigned long long total = 0, dropped_total = 0;
+    for (unsigned int t = 0; t < threads; t++) {
+        TraceRing *ring = &trace_rings[t];
+        unsigned long long count = ring->written < TRACE_RING_EVENTS ? ring->written : TRACE_RING_EVENTS;
+        unsigned long long dropped = ring->written - count;
+        unsigned int pad = 0;
+        fwrite(&t, sizeof(t), 1, file);
+        fwrite(&pad, sizeof(pad), 1, file);
+        fwrite(&count, sizeof(count), 1, file);
+        fwrite(&dropped, sizeof(dropped), 1, file);
+        
+        // Oldest first: after a wrap that's the slot the next event would take
+        unsigned long long first = ring->written - count;
+        for (unsigned long long k = 0; k < count; k++) {
+            fwrite(&ring->events[(first + k) & (TRACE_RING_EVENTS - 1)], sizeof(TraceEvent), 1, file);
+        }
+        total += count;
+        dropped_total += dropped;
+    }
+    fclose(file);
+    
+    printf("Trace: %llu events from %u threads written to %s", total, threads, filename);
+    if (dropped_total) printf(" (%llu oldest dropped)", dropped_total);
     printf("\n");
 }
 
+#else
+
+void export_solving_trace(const char *filename, SudokuGrid *grid) {
+    (void)filename;
+    (void)grid;
+    fprintf(stderr, "Error: Tracing not compiled in, build with -DSUDOKU_TRACE (make trace)\n");
+}
+
+#endif
+
 // ========== Puzzle Generation ==========
 
+// Random puzzle with a unique solution (uses rand(), so seed with srand()).
+// difficulty 0 keeps 36 clues, 1 keeps 30, 2+ removes clues until every
+// remaining one is needed (minimal puzzle, usually 21-25 clues).
+void generate_puzzle(SudokuGrid *grid, int difficulty) {
+    static const int target_clues[] = { 36, 30, 0 };
+    int target = target_clues[difficulty < 2 ? difficulty : 2];
+    
+    // Random full grid - solve an empty one with shuffled value order
+    SearchConfig config = search_config;
+    config.value_order = VALUE_RANDOM;
+    config.restart_nodes = 0;
+    config.seed = (unsigned int)rand() | 1;
+    
+    SolverStats stats = {0};
+    SearchStack *stack = search_stack_create();
+    init_grid(grid);
+    init_candidates(grid);
+    solve_iterative(stack, grid, &stats, &config, NULL);
+    search_stack_free(stack);
+    
+    // Take clues out in random order as long as the solution stays unique
+    int order[N * N];
+    for (int k = 0; k < N * N; k++) order[k] = k;
+    for (int k = N * N - 1; k > 0; k--) {
+        int r = rand() % (k + 1);
+        int tmp = order[k];
+        order[k] = order[r];
+        order[r] = tmp;
+    }
+    
+    int *cells = &grid->cells[0][0];
+    int clues = N * N;
+    for (int k = 0; k < N * N && clues > target; k++) {
+        int saved = cells[order[k]];
+        cells[order[k]] = UNASSIGNED;
+        if (count_solutions(grid, 2) == 1) {
+            clues--;
+        } else {
+            cells[order[k]] = saved;
+        }
+    }
+    
+    // Same state load_puzzle() leaves behind
+    for (int k = 0; k < N * N; k++) {
+        (&grid->candidates[0][0])[k] = 0x1FF;
+    }
+    grid->empty_cells = N * N - clues;
+}
+
 void generate_test_suite() {
     FILE *f;
     
@@ -885,29 +2693,38 @@ void generate_test_suite() {
 }
 
 // ========== Main Program ==========
+// Left out when the solvers are linked into another program (-DSUDOKU_NO_MAIN)
 
-int main(int argc, char *argv[]) {
-    if (argc < 2) {
-        printf("Advanced Sudoku Solver with OpenMP\n");
-        printf("Usage: %s <puzzle_file> [threads]\n", argv[0]);
-        printf("   Or: %s generate\n", argv[0]);
+#ifndef SUDOKU_NO_MAIN
+
+#define DEFAULT_ENGINE "bitboard"
+
+// Every engine on one puzzle, side by side with full stats and grids (what
+// the program used to do by default). argv[0] is the puzzle file.
+static int run_comparison(int argc, char *argv[]) {
+    if (argc < 1) {
+        printf("Error: benchmark needs a puzzle file\n");
         return 1;
     }
     
-    if (strcmp(argv[1], "generate") == 0) {
-        generate_test_suite();
-        return 0;
+    // Set number of threads if specified
+    if (argc >= 2) {
+        omp_set_num_threads(atoi(argv[1]));
     }
     
-    // Set number of threads if specified
-    if (argc >= 3) {
-        omp_set_num_threads(atoi(argv[2]));
+    if (argc >= 3 && !parse_search_config(argv[2], &search_config)) {
+        printf("Error: Unknown heuristic in '%s'\n", argv[2]);
+        return 1;
     }
     
+    SolveLimits limits = { 0, 0 };
+    if (argc >= 4) limits.time_limit = atof(argv[3]);
+    if (argc >= 5) limits.max_nodes = strtoull(argv[4], NULL, 10);
+    
     printf("OpenMP Max Threads: %d\n\n", omp_get_max_threads());
     
     SudokuGrid grid;
-    load_puzzle(argv[1], &grid);
+    load_puzzle(argv[0], &grid);
     
     printf("Original Puzzle (%d empty cells):\n", grid.empty_cells);
     print_grid(&grid);
@@ -918,58 +2735,110 @@ int main(int argc, char *argv[]) {
     copy_grid(&grid, &grid_serial);
     SolverStats stats_serial;
     
-    if (solve_serial(&grid_serial, &stats_serial)) {
+    int result = solve_serial(&grid_serial, &stats_serial, &limits);
+    if (result == 1) {
         printf("✓ SERIAL: Solution verified as %s\n", 
                verify_solution(&grid_serial) ? "CORRECT" : "INCORRECT");
         print_stats(&stats_serial, "SERIAL VERSION");
         print_grid(&grid_serial);
         printf("\n");
+    } else if (result == SOLVE_TIMED_OUT) {
+        printf("✗ SERIAL: Timed out with %d cells left\n", grid_serial.empty_cells);
+        print_stats(&stats_serial, "SERIAL VERSION");
+        print_grid(&grid_serial);
+        printf("\n");
     } else {
         printf("✗ SERIAL: No solution found\n\n");
     }
     
+#ifdef SUDOKU_TRACE
+    export_solving_trace("output/trace_serial.bin", &grid);
+#endif
+    
     // Parallel Version 1
     SudokuGrid grid_parallel1;
     copy_grid(&grid, &grid_parallel1);
     SolverStats stats_parallel1;
     
-    if (solve_parallel_v1(&grid_parallel1, &stats_parallel1)) {
+    result = solve_parallel_v1(&grid_parallel1, &stats_parallel1, &limits);
+    if (result == 1) {
         printf("✓ PARALLEL V1 (Tasks): Solution verified as %s\n", 
                verify_solution(&grid_parallel1) ? "CORRECT" : "INCORRECT");
         print_stats(&stats_parallel1, "PARALLEL V1 (OpenMP Tasks with Work Stealing)");
         printf("Speedup: %.2fx\n\n", stats_serial.time_taken / stats_parallel1.time_taken);
+    } else if (result == SOLVE_TIMED_OUT) {
+        printf("✗ PARALLEL V1: Timed out with %d cells left\n", grid_parallel1.empty_cells);
+        print_stats(&stats_parallel1, "PARALLEL V1 (OpenMP Tasks with Work Stealing)");
     } else {
         printf("✗ PARALLEL V1: No solution found\n\n");
     }
     
+#ifdef SUDOKU_TRACE
+    export_solving_trace("output/trace_v1.bin", &grid);
+#endif
+    
     // Parallel Version 2
     SudokuGrid grid_parallel2;
     copy_grid(&grid, &grid_parallel2);
     SolverStats stats_parallel2;
     
-    if (solve_parallel_v2(&grid_parallel2, &stats_parallel2)) {
+    result = solve_parallel_v2(&grid_parallel2, &stats_parallel2, &limits);
+    if (result == 1) {
         printf("✓ PARALLEL V2 (Speculative): Solution verified as %s\n", 
                verify_solution(&grid_parallel2) ? "CORRECT" : "INCORRECT");
         print_stats(&stats_parallel2, "PARALLEL V2 (Speculative Parallel For)");
         printf("Speedup: %.2fx\n\n", stats_serial.time_taken / stats_parallel2.time_taken);
+    } else if (result == SOLVE_TIMED_OUT) {
+        printf("✗ PARALLEL V2: Timed out with %d cells left\n", grid_parallel2.empty_cells);
+        print_stats(&stats_parallel2, "PARALLEL V2 (Speculative Parallel For)");
     } else {
         printf("✗ PARALLEL V2: No solution found\n\n");
     }
     
+#ifdef SUDOKU_TRACE
+    export_solving_trace("output/trace_v2.bin", &grid);
+#endif
+    
     // Parallel Version 3 (Hybrid)
     SudokuGrid grid_parallel3;
     copy_grid(&grid, &grid_parallel3);
     SolverStats stats_parallel3;
     
-    if (solve_parallel_v3(&grid_parallel3, &stats_parallel3)) {
+    result = solve_parallel_v3(&grid_parallel3, &stats_parallel3, &limits);
+    if (result == 1) {
         printf("✓ PARALLEL V3 (Hybrid): Solution verified as %s\n", 
                verify_solution(&grid_parallel3) ? "CORRECT" : "INCORRECT");
         print_stats(&stats_parallel3, "PARALLEL V3 (Adaptive Hybrid Strategy)");
         printf("Speedup: %.2fx\n\n", stats_serial.time_taken / stats_parallel3.time_taken);
+    } else if (result == SOLVE_TIMED_OUT) {
+        printf("✗ PARALLEL V3: Timed out with %d cells left\n", grid_parallel3.empty_cells);
+        print_stats(&stats_parallel3, "PARALLEL V3 (Adaptive Hybrid Strategy)");
     } else {
         printf("✗ PARALLEL V3: No solution found\n\n");
     }
     
+#ifdef SUDOKU_TRACE
+    export_solving_trace("output/trace_v3.bin", &grid);
+#endif
+    
+    // Bitboard engine (single thread)
+    SudokuGrid grid_bitboard;
+    copy_grid(&grid, &grid_bitboard);
+    SolverStats stats_bitboard;
+    
+    result = solve_bitboard(&grid_bitboard, &stats_bitboard, &limits);
+    if (result == 1) {
+        printf("✓ BITBOARD: Solution verified as %s\n", 
+               verify_solution(&grid_bitboard) ? "CORRECT" : "INCORRECT");
+        print_stats(&stats_bitboard, "BITBOARD (Band Bitmasks, Single Thread)");
+        printf("Speedup: %.2fx\n\n", stats_serial.time_taken / stats_bitboard.time_taken);
+    } else if (result == SOLVE_TIMED_OUT) {
+        printf("✗ BITBOARD: Timed out with %d cells left\n", grid_bitboard.empty_cells);
+        print_stats(&stats_bitboard, "BITBOARD (Band Bitmasks, Single Thread)");
+    } else {
+        printf("✗ BITBOARD: No solution found\n\n");
+    }
+    
     // Summary
     printf("╔═══════════════════════════════════════════════════════════╗\n");
     printf("║                    PERFORMANCE SUMMARY                    ║\n");
@@ -982,7 +2851,423 @@ int main(int argc, char *argv[]) {
            stats_parallel2.time_taken, stats_serial.time_taken / stats_parallel2.time_taken);
     printf("║ Parallel V3:  %10.6f sec  │ Speedup: %10.2fx ║\n", 
            stats_parallel3.time_taken, stats_serial.time_taken / stats_parallel3.time_taken);
+    printf("║ Bitboard:     %10.6f sec  │ Speedup: %10.2fx ║\n", 
+           stats_bitboard.time_taken, stats_serial.time_taken / stats_bitboard.time_taken);
     printf("╚═══════════════════════════════════════════════════════════╝\n");
     
     return 0;
 }
+
+
+static void print_usage(const char *prog) {
+    printf("Advanced Sudoku Solver with OpenMP\n");
+    printf("Usage: %s [options] <puzzle_file | 81-char puzzle>\n", prog);
+    printf("  --engine NAME       serial, v1, v2, v3, portfolio, bitboard (default %s)\n", DEFAULT_ENGINE);
+    printf("  --threads N         team size for the parallel engines\n");
+    printf("  --heuristics SPEC   comma separated: mrv degree ascending lcv freq random restarts\n");
+    printf("                      singles full subsets0..subsets4 xwing swordfish xywing fish tt nogoods deterministic\n");
+    printf("  --time-limit S      per solve, 0 = unlimited\n");
+    printf("  --max-nodes N       per solve (all threads together), 0 = unlimited\n");
+    printf("  --repeat N          solve N times, report the best and mean time\n");
+    printf("  --quiet             only the result line\n");
+    printf("  --json              stats as one line of JSON after the result line\n");
+    printf("  --trace FILE        write the search trace (trace build only)\n");
+    printf("Prints '<81 chars> <solved|unsolvable|timeout|invalid>', exit code 0 / 2 / 3 / 4.\n");
+    printf("   Or: %s benchmark <puzzle_file> [threads] [heuristics] [time_limit_s] [max_nodes]\n", prog);
+    printf("       (every engine side by side, full stats and grids)\n");
+    printf("   Or: %s generate\n", prog);
+    printf("   Or: %s corpus <easy|medium|minimal> <count> [seed]  (one puzzle per line to stdout)\n", prog);
+    printf("   Or: %s batch <corpus_file> [threads] [node_budget]  (one thread per puzzle, split stragglers)\n", prog);
+    printf("   Or: %s rate <corpus_file> [threads] [--quiet]  (hardest technique needed per puzzle)\n", prog);
+    printf("   Or: %s verify <batch_file> [threads] [--unique] [--all]  ('<grid> [<puzzle>]' per line)\n", prog);
+    printf("   Or: %s async <corpus_file> [threads] [engine]  (submit everything to the solve queue)\n", prog);
+    printf("   Or: %s serve <socket_path> [threads] [engine] [time_limit_s]  (daemon, one puzzle per line)\n", prog);
+    printf("batch, async and serve write live metrics to $SUDOKU_METRICS_FILE (Prometheus text) every\n");
+    printf("$SUDOKU_METRICS_INTERVAL seconds (default 10) if it is set.\n");
+}
+
+static const char *result_name(int result) {
+    return result == 1 ? "solved" : result == SOLVE_TIMED_OUT ? "timeout" :
+           result == RESULT_INVALID ? "invalid" : "unsolvable";
+}
+
+static void print_stats_json(const char *engine, int threads, int result, int runs,
+                             double best, double mean, SolverStats *stats) {
+    printf("{\"engine\":\"%s\",\"threads\":%d,\"result\":\"%s\",\"runs\":%d,"
+           "\"best_s\":%.9f,\"mean_s\":%.9f,\"nodes\":%llu,\"backtracks\":%llu,"
+           "\"naked_singles\":%llu,\"hidden_singles\":%llu,\"pointing_pairs\":%llu,"
+           "\"box_line\":%llu,\"restarts\":%llu,\"tt_hits\":%llu,\"search_s\":%.9f,\"redundant_s\":%.9f,"
+           "\"sync_s\":%.9f,\"idle_s\":%.9f}\n",
+           engine, threads, result_name(result), runs, best, mean, stats->nodes_explored,
+           stats->backtrack_count, stats->naked_singles_found, stats->hidden_singles_found,
+           stats->pointing_pairs_found, stats->box_line_reductions, stats->restarts, stats->tt_hits,
+           stats->search_time, stats->redundant_time, stats->sync_time, stats->idle_time);
+}
+
+// One engine, one puzzle, compact output - the normal way to run the solver
+static int run_cli(int argc, char *argv[]) {
+    const SolverEngine *engine = find_engine(DEFAULT_ENGINE);
+    SolveLimits limits = { 0, 0 };
+    const char *puzzle = NULL, *trace_file = NULL;
+    int threads = 0, repeat = 1, quiet = 0, json = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int ok = 1;
+        
+        if (strcmp(arg, "--help") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else if (strcmp(arg, "--quiet") == 0) {
+            quiet = 1;
+        } else if (strcmp(arg, "--json") == 0) {
+            json = 1;
+        } else if (arg[0] == '-' && arg[1] == '-') {
+            if (!value) ok = 0;
+            else if (strcmp(arg, "--engine") == 0) ok = (engine = find_engine(value)) != NULL;
+            else if (strcmp(arg, "--threads") == 0) ok = (threads = atoi(value)) > 0;
+            else if (strcmp(arg, "--heuristics") == 0) ok = parse_search_config(value, &search_config);
+            else if (strcmp(arg, "--time-limit") == 0) limits.time_limit = atof(value);
+            else if (strcmp(arg, "--max-nodes") == 0) limits.max_nodes = strtoull(value, NULL, 10);
+            else if (strcmp(arg, "--repeat") == 0) ok = (repeat = atoi(value)) > 0;
+#ifdef SUDOKU_TRACE
+            else if (strcmp(arg, "--trace") == 0) trace_file = value;
+#else
+            else if (strcmp(arg, "--trace") == 0) {
+                printf("Error: --trace needs a trace build (make trace)\n");
+                return 1;
+            }
+#endif
+            else ok = 0;
+            i++;
+        } else if (!puzzle) {
+            puzzle = arg;
+        } else {
+            ok = 0;
+        }
+        
+        if (!ok) {
+            printf("Error: Bad option %s\n", arg);
+            return 1;
+        }
+    }
+    if (!puzzle) {
+        printf("Error: No puzzle given\n");
+        return 1;
+    }
+    if (threads) omp_set_num_threads(threads);
+    
+    SudokuGrid original;
+    if (strlen(puzzle) != N * N || !parse_puzzle_line(puzzle, &original)) {
+        load_puzzle(puzzle, &original);
+    }
+    
+    SudokuGrid grid;
+    SolverStats stats = {0};
+    int result = RESULT_INVALID;
+    double best = 0, total = 0;
+    copy_grid(&original, &grid);
+    if (!check_givens(&original)) repeat = 0;
+    for (int r = 0; r < repeat; r++) {
+        copy_grid(&original, &grid);
+        result = engine->solve(&grid, &stats, &limits);
+        if (r == 0 || stats.time_taken < best) best = stats.time_taken;
+        total += stats.time_taken;
+    }
+    if (result == 1 && !verify_solution(&grid)) {
+        printf("Error: %s returned an invalid solution\n", engine->name);
+        return 1;
+    }
+    if (trace_file) export_solving_trace(trace_file, &original);
+    
+    char line[N * N + 1];
+    format_puzzle_line(&grid, line);
+    printf("%s %s\n", line, result_name(result));
+    
+    int team = engine->parallel ? omp_get_max_threads() : 1;
+    if (json) {
+        print_stats_json(engine->name, team, result, repeat, best, repeat ? total / repeat : 0, &stats);
+    } else if (!quiet) {
+        printf("# engine=%s threads=%d runs=%d best=%.6fs mean=%.6fs nodes=%llu backtracks=%llu\n",
+               engine->name, team, repeat, best, repeat ? total / repeat : 0, stats.nodes_explored,
+               stats.backtrack_count);
+        if (stats.tt_stores) {
+            printf("# transpositions: %llu dead states stored, %llu duplicate states pruned\n",
+                   stats.tt_stores, stats.tt_hits);
+        }
+        if (stats.nogoods_learned) {
+            printf("# nogoods: %llu learned, %llu nodes pruned, %llu candidates eliminated\n",
+                   stats.nogoods_learned, stats.nogood_prunes, stats.nogood_eliminations);
+        }
+    }
+    
+    return result == 1 ? 0 : result == SOLVE_TIMED_OUT ? 3 : result == RESULT_INVALID ? 4 : 2;
+}
+
+// Long-running modes dump live metrics to a file if asked to
+static void start_metrics_dumper(void) {
+    const char *path = getenv("SUDOKU_METRICS_FILE");
+    const char *interval = getenv("SUDOKU_METRICS_INTERVAL");
+    if (path && *path && !metrics_start_dumper(path, interval ? atof(interval) : 0)) {
+        printf("Error: Could not start the metrics dumper\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    
+    int long_running = strcmp(argv[1], "batch") == 0 || strcmp(argv[1], "async") == 0 ||
+                       strcmp(argv[1], "serve") == 0;
+    if (long_running) {
+        start_metrics_dumper();
+        atexit(metrics_stop_dumper);
+    }
+    
+    if (strcmp(argv[1], "benchmark") == 0) {
+        return run_comparison(argc - 2, argv + 2);
+    }
+    
+    if (strcmp(argv[1], "generate") == 0) {
+        generate_test_suite();
+        return 0;
+    }
+    
+    if (strcmp(argv[1], "corpus") == 0) {
+        static const char *classes[] = { "easy", "medium", "minimal" };
+        int difficulty = -1;
+        for (int d = 0; d < 3; d++) {
+            if (argc >= 3 && strcmp(argv[2], classes[d]) == 0) difficulty = d;
+        }
+        if (difficulty < 0 || argc < 4) {
+            printf("Error: corpus needs a class (easy, medium, minimal) and a count\n");
+            return 1;
+        }
+        srand(argc >= 5 ? atoi(argv[4]) : 1);
+        
+        int count = atoi(argv[3]);
+        char line[N * N + 1];
+        for (int i = 0; i < count; i++) {
+            SudokuGrid grid;
+            generate_puzzle(&grid, difficulty);
+            format_puzzle_line(&grid, line);
+            printf("%s\n", line);
+        }
+        return 0;
+    }
+    
+    if (strcmp(argv[1], "batch") == 0) {
+        if (argc < 3) {
+            printf("Error: batch needs a corpus file\n");
+            return 1;
+        }
+        if (argc >= 4) omp_set_num_threads(atoi(argv[3]));
+        unsigned long long budget = argc >= 5 ? strtoull(argv[4], NULL, 10) : HYBRID_NODE_BUDGET;
+        
+        SudokuGrid *puzzles;
+        int count = load_puzzle_batch(argv[2], &puzzles);
+        SudokuGrid *work = malloc(count * sizeof(SudokuGrid));
+        int *results = malloc(count * sizeof(int));
+        if (count == 0 || !work || !results) {
+            printf("Error: No puzzles in %s\n", argv[2]);
+            return 1;
+        }
+        
+        // Same batch without splitting first, so the straggler effect is visible
+        unsigned long long budgets[2] = { 0, budget };
+        const char *names[2] = { "INTER-PUZZLE ONLY (no splitting)", "HYBRID (split over budget)" };
+        for (int b = 0; b < 2; b++) {
+            SolverStats stats;
+            memcpy(work, puzzles, count * sizeof(SudokuGrid));
+            int solved = solve_batch_hybrid(work, count, results, &stats, budgets[b]);
+            int verified = 0;
+            for (int i = 0; i < count; i++) verified += results[i] && verify_solution(&work[i]);
+            
+            printf("%d/%d puzzles solved, %d verified as CORRECT\n", solved, count, verified);
+            print_stats(&stats, names[b]);
+        }
+        
+        free(results);
+        free(work);
+        free(puzzles);
+        return 0;
+    }
+    
+    if (strcmp(argv[1], "rate") == 0) {
+        if (argc < 3) {
+            printf("Error: rate needs a corpus file\n");
+            return 1;
+        }
+        int quiet = 0;
+        for (int i = 3; i < argc; i++) {
+            if (strcmp(argv[i], "--quiet") == 0) quiet = 1;
+            else omp_set_num_threads(atoi(argv[i]));
+        }
+        
+        SudokuGrid *puzzles;
+        int count = load_puzzle_batch(argv[2], &puzzles);
+        SudokuGrid *work = malloc(count * sizeof(SudokuGrid));
+        PuzzleRating *ratings = malloc(count * sizeof(PuzzleRating));
+        if (count == 0 || !work || !ratings) {
+            printf("Error: No puzzles in %s\n", argv[2]);
+            return 1;
+        }
+        memcpy(work, puzzles, count * sizeof(SudokuGrid));
+        
+        double start = omp_get_wtime();
+        rate_batch(work, count, ratings);
+        double elapsed = omp_get_wtime() - start;
+        
+        // '<puzzle> <score> <hardest> <steps> <search nodes>' in corpus order
+        int by_level[RATE_LEVELS] = {0}, failed = 0;
+        char line[N * N + 1];
+        for (int i = 0; i < count; i++) {
+            PuzzleRating *r = &ratings[i];
+            if (r->result == 1 && r->hardest >= 0) by_level[r->hardest]++;
+            failed += r->result != 1;
+            if (quiet) continue;
+            format_puzzle_line(&puzzles[i], line);
+            if (r->result != 1) {
+                printf("%s %s\n", line, r->result == RESULT_INVALID ? "invalid" : "unsolvable");
+            } else {
+                printf("%s %.1f %s %d %llu\n", line, r->score, rating_level_name(r->hardest),
+                       r->steps, r->search_nodes);
+            }
+        }
+        
+        printf("# %d puzzles, %d threads, %.6f s, %.0f puzzles/s\n", count, omp_get_max_threads(),
+               elapsed, elapsed > 0 ? count / elapsed : 0.0);
+        for (int l = 0; l < RATE_LEVELS; l++) {
+            if (by_level[l]) printf("# %-18s %d\n", rating_level_name(l), by_level[l]);
+        }
+        if (failed) printf("# %-18s %d\n", "unsolvable/invalid", failed);
+        
+        free(ratings);
+        free(work);
+        free(puzzles);
+        return 0;
+    }
+    
+    if (strcmp(argv[1], "verify") == 0) {
+        if (argc < 3) {
+            printf("Error: verify needs a batch file\n");
+            return 1;
+        }
+        int check_unique = 0, show_all = 0;
+        for (int i = 3; i < argc; i++) {
+            if (strcmp(argv[i], "--unique") == 0) check_unique = 1;
+            else if (strcmp(argv[i], "--all") == 0) show_all = 1;
+            else omp_set_num_threads(atoi(argv[i]));
+        }
+        
+        VerifyReport report;
+        unsigned char *codes;
+        unsigned int *lines;
+        long long count = verify_batch_file(argv[2], check_unique, &report, &codes, &lines);
+        
+        // Per-record codes by line number, only the failures unless --all
+        for (long long r = 0; r < count; r++) {
+            if (show_all || codes[r] > VERIFY_PARTIAL) {
+                printf("%u %s\n", lines[r], verify_code_name(codes[r]));
+            }
+        }
+        
+        printf("# %lld records, %d threads, %.6f s, %.0f records/s\n", report.records,
+               report.threads, report.seconds,
+               report.seconds > 0 ? report.records / report.seconds : 0.0);
+        for (int c = 0; c < VERIFY_CODES; c++) {
+            if (report.counts[c]) printf("# %-14s %lld\n", verify_code_name(c), report.counts[c]);
+        }
+        
+        long long failed = report.records - report.counts[VERIFY_OK] - report.counts[VERIFY_PARTIAL];
+        free(codes);
+        free(lines);
+        return failed ? 2 : 0;
+    }
+    
+    if (strcmp(argv[1], "async") == 0) {
+        if (argc < 3) {
+            printf("Error: async needs a corpus file\n");
+            return 1;
+        }
+        int threads = argc >= 4 ? atoi(argv[3]) : 0;
+        const SolverEngine *engine = find_engine(argc >= 5 ? argv[4] : DEFAULT_ENGINE);
+        if (!engine) {
+            printf("Error: Unknown engine %s\n", argv[4]);
+            return 1;
+        }
+        
+        SudokuGrid *puzzles;
+        int count = load_puzzle_batch(argv[2], &puzzles);
+        if (count == 0) {
+            printf("Error: No puzzles in %s\n", argv[2]);
+            return 1;
+        }
+        SolveQueue *queue = solve_queue_create(threads, 0, engine->solve, NULL, NULL, NULL);
+        if (!queue) {
+            printf("Error: Could not start the solve queue\n");
+            return 1;
+        }
+        
+        // Submit as fast as the queue takes puzzles, collect one completion
+        // whenever it's full (or everything is in)
+        double start = omp_get_wtime(), submit_time = 0, latency = 0, queued = 0, worst = 0;
+        unsigned long long nodes = 0;
+        int next = 0, collected = 0, refused = 0, solved = 0, verified = 0;
+        SolveCompletion done;
+        while (collected < count) {
+            while (next < count) {
+                double t = omp_get_wtime();
+                unsigned long long ticket = solve_queue_submit(queue, &puzzles[next], NULL);
+                submit_time += omp_get_wtime() - t;
+                if (!ticket) {
+                    refused++;
+                    break;
+                }
+                next++;
+            }
+            if (!solve_queue_wait(queue, &done)) break;
+            collected++;
+            solved += done.result == 1;
+            verified += done.result == 1 && verify_solution(&done.grid);
+            nodes += done.stats.nodes_explored;
+            latency += done.finished - done.submitted;
+            queued += done.started - done.submitted;
+            if (done.finished - done.submitted > worst) worst = done.finished - done.submitted;
+        }
+        double elapsed = omp_get_wtime() - start;
+        
+        printf("%d/%d puzzles solved, %d verified as CORRECT\n", solved, count, verified);
+        printf("# engine=%s threads=%d %.6f s, %.0f puzzles/s, %llu nodes\n", engine->name,
+               solve_queue_threads(queue), elapsed, elapsed > 0 ? count / elapsed : 0.0, nodes);
+        printf("# submit %.3f us mean, %d times the queue was full\n", 1e6 * submit_time / count, refused);
+        printf("# latency %.1f us mean (%.1f us queued), %.1f us max\n", 1e6 * latency / count,
+               1e6 * queued / count, 1e6 * worst);
+        
+        solve_queue_destroy(queue);
+        free(puzzles);
+        return solved == count ? 0 : 2;
+    }
+    
+    if (strcmp(argv[1], "serve") == 0) {
+        if (argc < 3) {
+            printf("Error: serve needs a socket path\n");
+            return 1;
+        }
+        int threads = argc >= 4 ? atoi(argv[3]) : 0;
+        const SolverEngine *engine = find_engine(argc >= 5 ? argv[4] : DEFAULT_ENGINE);
+        SolveLimits limits = { argc >= 6 ? atof(argv[5]) : 0, 0 };
+        if (!engine) {
+            printf("Error: Unknown engine %s\n", argv[4]);
+            return 1;
+        }
+        return serve_unix_socket(argv[2], threads, engine, &limits);
+    }
+    
+    return run_cli(argc, argv);
+}
+
+#endif
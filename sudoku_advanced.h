@@ -0,0 +1,425 @@
+// Sudoku solver library interface - shared by sudoku_advanced.c and the
+// programs that link the solvers directly (benchmark.c)
+
+#ifndef SUDOKU_ADVANCED_H
+#define SUDOKU_ADVANCED_H
+
+#define N 9
+#define UNASSIGNED 0
+#define MAX_THREADS 16
+
+// Naked/hidden subsets are searched up to this size (a naked subset of k
+// cells is a hidden one of 9 - k, so 4 covers everything in a 9-cell unit)
+#define MAX_SUBSET_SIZE 4
+
+// Stats tracking - keeps count of backtracks, techniques used, etc.
+typedef struct {
+    unsigned long long backtrack_count;
+    unsigned long long naked_singles_found;
+    unsigned long long hidden_singles_found;
+    unsigned long long naked_subsets[MAX_SUBSET_SIZE + 1];   // eliminations by subset size (2..)
+    unsigned long long hidden_subsets[MAX_SUBSET_SIZE + 1];
+    unsigned long long pointing_pairs_found;
+    unsigned long long xwing_eliminations;
+    unsigned long long swordfish_eliminations;
+    unsigned long long xy_wing_eliminations;
+    unsigned long long box_line_reductions;
+    unsigned long long nodes_explored;
+    unsigned long long degree_tiebreaks;     // MRV ties settled by degree
+    unsigned long long lcv_orderings;        // nodes ordered least-constraining first
+    unsigned long long frequency_orderings;  // nodes ordered by digit frequency
+    unsigned long long random_orderings;     // nodes with shuffled values
+    unsigned long long restarts;
+    unsigned long long budget_splits;  // over-budget searches split into tasks
+    unsigned long long tt_hits;        // states found dead in the transposition table
+    unsigned long long tt_stores;      // dead states added to it
+    unsigned long long nogoods_learned;
+    unsigned long long nogood_prunes;        // nodes cut because a nogood held in full
+    unsigned long long nogood_eliminations;  // candidates removed by a nogood missing one assignment
+    int timed_out;                     // a SolveLimits deadline or node budget ran out
+    double time_taken;
+    // Where the threads' time went, summed over threads (seconds). Whatever
+    // is left of threads_used * time_taken is idle_time.
+    double search_time;       // inside the search, including redundant_time
+    double redundant_time;    // search still running after another thread solved it
+    double sync_time;         // team start-up and critical sections
+    double idle_time;
+    int threads_used;
+    int thread_id;
+} SolverStats;
+
+// Using bitsets for candidate tracking - more efficient than arrays
+typedef unsigned short CandidateSet;
+
+// Main grid structure
+typedef struct {
+    int cells[N][N];
+    CandidateSet candidates[N][N];  // possible values for each cell
+    int empty_cells;
+    unsigned long long hash;  // Zobrist hash of cells, updated by init/update_candidates()
+} SudokuGrid;
+
+// Which cell to branch on
+typedef enum {
+    CELL_MRV,         // first cell with the fewest candidates
+    CELL_MRV_DEGREE   // MRV, ties go to the cell with the most empty peers
+} CellHeuristic;
+
+// Which order to try the values of that cell in
+typedef enum {
+    VALUE_ASCENDING,  // 1..9
+    VALUE_LCV,        // least constraining value first
+    VALUE_FREQUENCY,  // digits already placed most often first
+    VALUE_RANDOM      // shuffled (meant to be used with restarts)
+} ValueOrder;
+
+// How much inference to run at every node
+typedef enum {
+    PROPAGATE_ALL,     // singles, naked/hidden subsets, pointing pairs
+    PROPAGATE_SINGLES  // naked + hidden singles only - cheaper nodes, bigger tree
+} PropagationLevel;
+
+// Optional PROPAGATE_ALL techniques (flags). They only run once the basic
+// ones stall, since they cost more per node than they usually save.
+enum {
+    EXTRA_XWING = 1,
+    EXTRA_SWORDFISH = 2,
+    EXTRA_XY_WING = 4
+};
+
+// Deadline and node budget of one solve, shared by all of its threads. Each
+// thread charges its nodes in chunks of BUDGET_CHECK_INTERVAL with a single
+// atomic add and reads the clock only then, so the inner loop stays cheap.
+typedef struct {
+    double deadline;                // omp_get_wtime() value, 0 = none
+    unsigned long long max_nodes;   // total over all threads, 0 = none
+    unsigned long long nodes;       // charged so far
+    volatile int expired;
+} SolveBudget;
+
+#define BUDGET_CHECK_INTERVAL 64
+
+// Transposition table shared by all threads of a solve: Zobrist hashes of
+// grids (cells only, before propagation) that are known to have no solution.
+// Restarts and portfolio workers reach the same partial grids over and over.
+// Entries are single 64-bit words, read and written atomically without
+// locks; a lost race just loses an entry. Key 0 means empty.
+typedef struct {
+    unsigned long long *keys;
+    unsigned long long mask;
+} TranspositionTable;
+
+#define TT_BITS 20  // 1M entries, 8 MB
+#define TT_WAYS 4   // slots probed per key
+
+// Nogoods: small sets of assignments (cell = value) that can't all hold in
+// any solution of the puzzle, learned from failed branches and shared by all
+// threads of a solve. A nogood is one 64-bit word - up to MAX_NOGOOD_SIZE
+// 12-bit literals (cell << 4 | value) - so entries are read and written
+// atomically without locks. The store is a fixed ring, the oldest nogood
+// goes first. Nogoods are relative to root (the puzzle as the solve started).
+#define MAX_NOGOOD_SIZE 4
+#define NOGOOD_CAPACITY 1024
+#define NOGOOD_MINIMIZE_MAX 8  // longer failure paths aren't worth shrinking
+
+typedef struct {
+    unsigned long long entries[NOGOOD_CAPACITY];  // 0 = empty
+    unsigned int next;                            // insert position (wraps)
+    SudokuGrid root;
+} NogoodStore;
+
+typedef struct {
+    CellHeuristic cell_order;
+    ValueOrder value_order;
+    unsigned long long restart_nodes;  // first restart cutoff, 0 = never restart
+    unsigned int seed;
+    PropagationLevel propagation;
+    unsigned long long node_limit;     // give up after this many nodes, 0 = no limit
+    SolveBudget *budget;               // shared deadline/node budget, NULL = none
+    int deterministic;                 // V1/V2: leftmost solution wins, stats independent of threads
+    int subset_size;                   // PROPAGATE_ALL: largest naked/hidden subset, < 2 = none
+    int extra_techniques;              // PROPAGATE_ALL: EXTRA_* flags
+    int transpositions;                // share dead states between restarts and workers
+    TranspositionTable *tt;            // the solve's table (set by the entry points), NULL = none
+    int nogoods;                       // learn nogoods from failed branches (not in deterministic mode)
+    NogoodStore *nogood_store;         // the solve's store (set by the entry points), NULL = none
+    volatile int *outer_stop;          // cancel flag of the enclosing V1 branch, NULL = none
+} SearchConfig;
+
+// solve_iterative() result when node_limit or the budget ran out. The stack is
+// left holding the untried branches, so the rest of the search can be handed
+// out with search_stack_steal(), and grid gets the propagated root.
+#define SEARCH_OVER_BUDGET (-1)
+
+// What a caller allows one solve to take. All zero = no limits (same as NULL).
+typedef struct {
+    double time_limit;              // seconds from the call
+    unsigned long long max_nodes;   // search nodes over all threads
+} SolveLimits;
+
+// Solver entry points return 1 (solved), 0 (no solution) or SOLVE_TIMED_OUT,
+// in which case grid holds everything propagation could place and stats the
+// work done so far
+#define SOLVE_TIMED_OUT SEARCH_OVER_BUDGET
+#define RESULT_INVALID (-2)  // givens clash, not solved at all
+
+// Restart cutoff grows by this factor every time so the search stays complete
+#define RESTART_BASE_NODES 64
+#define RESTART_GROWTH 1.5
+
+// One frame of the explicit DFS stack. Holds the propagated grid at that
+// depth plus the branching cell and the values still left to try, in order
+// (values[next..count) are untried)
+typedef struct {
+    SudokuGrid grid;
+    unsigned char values[N];
+    unsigned char next, count;
+    unsigned char row, col;
+    unsigned char partial;   // branches were stolen, so it's never searched in full here
+    unsigned long long key;  // grid hash for the transposition table
+} SearchNode;
+
+// Every branch fills one cell, so depth can never go past 81 (+1 for the leaf)
+#define MAX_SEARCH_DEPTH (N * N + 1)
+
+typedef struct {
+    SearchNode nodes[MAX_SEARCH_DEPTH];
+    int top;  // number of branching nodes currently on the stack
+} SearchStack;
+
+// Function declarations
+int solve_serial(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+int solve_parallel_v1(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+int solve_parallel_v2(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+int solve_parallel_v3(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+int solve_parallel_portfolio(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+// Default per-puzzle node budget before the batch hybrid splits a puzzle
+#define HYBRID_NODE_BUDGET 1000
+int solve_bitboard(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+int solve_batch_hybrid(SudokuGrid *puzzles, int count, int *results, SolverStats *stats,
+                       unsigned long long node_budget);
+
+void init_grid(SudokuGrid *grid);
+void copy_grid(SudokuGrid *src, SudokuGrid *dst);
+int verify_solution(SudokuGrid *grid);
+int check_givens(SudokuGrid *grid);
+void load_puzzle(const char *filename, SudokuGrid *grid);
+int parse_puzzle_line(const char *line, SudokuGrid *grid);
+void format_puzzle_line(SudokuGrid *grid, char *line);
+int load_puzzle_batch(const char *filename, SudokuGrid **grids);
+void print_grid(SudokuGrid *grid);
+void print_stats(SolverStats *stats, const char *version);
+void aggregate_stats(SolverStats *stats_array, int count, SolverStats *result);
+
+// Solve limits, shared by all engines
+SolveBudget *budget_init(SolveBudget *budget, const SolveLimits *limits, double start);
+int budget_expired(SolveBudget *budget, unsigned long long nodes);
+
+// Transposition table
+unsigned long long grid_hash(SudokuGrid *grid);  // from scratch, same value as grid->hash
+TranspositionTable *tt_create(int bits);
+void tt_free(TranspositionTable *tt);
+int tt_probe(TranspositionTable *tt, unsigned long long key);
+void tt_store(TranspositionTable *tt, unsigned long long key);
+
+// Nogood store
+NogoodStore *nogood_create(SudokuGrid *root);
+void nogood_free(NogoodStore *store);
+int apply_nogoods(NogoodStore *store, SudokuGrid *grid, SolverStats *stats);
+
+// Iterative search engine (explicit stack instead of recursion)
+SearchStack *search_stack_create(void);
+void search_stack_free(SearchStack *stack);
+int search_stack_steal(SearchStack *stack, SudokuGrid *out);
+int solve_iterative(SearchStack *stack, SudokuGrid *grid, SolverStats *stats,
+                    const SearchConfig *config, volatile int *stop);
+int solve_with_techniques(SudokuGrid *grid, SolverStats *stats);
+int count_solutions(SudokuGrid *grid, int limit);
+
+// Advanced solving techniques
+int apply_naked_singles(SudokuGrid *grid, SolverStats *stats);
+int apply_hidden_singles(SudokuGrid *grid, SolverStats *stats);
+int apply_subsets(SudokuGrid *grid, SolverStats *stats, int max_size);
+int apply_pointing_pairs(SudokuGrid *grid, SolverStats *stats);
+int apply_box_line_reduction(SudokuGrid *grid, SolverStats *stats);
+int apply_fish(SudokuGrid *grid, SolverStats *stats, int size);
+int apply_xy_wing(SudokuGrid *grid, SolverStats *stats);
+int apply_constraint_propagation(SudokuGrid *grid, SolverStats *stats);
+int apply_propagation_level(SudokuGrid *grid, SolverStats *stats, const SearchConfig *config);
+
+// Candidate management
+void init_candidates(SudokuGrid *grid);
+void update_candidates(SudokuGrid *grid, int row, int col, int num);
+int count_candidates(CandidateSet cand);
+int get_candidate(CandidateSet cand, int index);
+CandidateSet make_candidate_set(int *values, int count);
+
+// Heuristics
+int find_best_cell(SudokuGrid *grid, int *row, int *col);
+int select_branch_cell(SudokuGrid *grid, const SearchConfig *config, unsigned int *rng,
+                       SolverStats *stats, int *row, int *col);
+int order_values(SudokuGrid *grid, int row, int col, const SearchConfig *config,
+                 unsigned int *rng, SolverStats *stats, unsigned char *values);
+int parse_search_config(const char *spec, SearchConfig *config);
+double estimate_difficulty(SudokuGrid *grid);
+
+// Technique rating, easiest first (the order rate_puzzle() tries them in)
+typedef enum {
+    RATE_HIDDEN_SINGLE,
+    RATE_NAKED_SINGLE,
+    RATE_LOCKED,        // pointing pairs / box-line
+    RATE_PAIR,          // naked or hidden
+    RATE_XWING,
+    RATE_TRIPLE,
+    RATE_SWORDFISH,
+    RATE_XY_WING,
+    RATE_QUAD,
+    RATE_SEARCH,        // none of the above finished it
+    RATE_LEVELS
+} RatingLevel;
+
+typedef struct {
+    int result;                     // 1 solved, 0 no solution, RESULT_INVALID
+    int hardest;                    // RatingLevel, -1 if nothing was needed
+    int steps;                      // technique applications that made progress
+    int level_steps[RATE_LEVELS];
+    unsigned long long search_nodes;  // RATE_SEARCH: nodes the fallback search took
+    double score;                   // weight of the hardest technique, search adds 0.5 per doubling of its nodes
+} PuzzleRating;
+
+const char *rating_level_name(int level);
+int rate_puzzle(SudokuGrid *grid, PuzzleRating *rating);
+void rate_batch(SudokuGrid *puzzles, int count, PuzzleRating *ratings);
+
+// Puzzle generation
+void generate_puzzle(SudokuGrid *grid, int difficulty);
+void generate_test_suite();
+
+// Visualization
+void print_candidates(SudokuGrid *grid);
+void export_solving_trace(const char *filename, SudokuGrid *grid);
+
+// Solver engines by name, shared by the CLI and the benchmark
+typedef int (*SolverFunc)(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits);
+
+typedef struct {
+    const char *name;
+    SolverFunc solve;
+    int parallel;  // runs on the OpenMP team (the others are single threaded)
+} SolverEngine;
+
+#define NUM_ENGINES 6
+extern const SolverEngine solver_engines[NUM_ENGINES];
+const SolverEngine *find_engine(const char *name);
+
+// Bulk verification of submitted grids (sudoku_verify.c)
+typedef enum {
+    VERIFY_OK,             // complete, consistent, matches its clues
+    VERIFY_PARTIAL,        // consistent so far but has empty cells
+    VERIFY_BAD_FORMAT,     // not 81 cells of 1-9 / . / 0
+    VERIFY_CONFLICT,       // a digit repeats in a row, column or box
+    VERIFY_CLUE_MISMATCH,  // a clue of the original puzzle was changed
+    VERIFY_NO_SOLUTION,    // --unique: the puzzle (or the partial grid) can't be finished
+    VERIFY_NOT_UNIQUE,     // --unique: the puzzle has more than one solution
+    VERIFY_CODES
+} VerifyCode;
+
+typedef struct {
+    long long records;
+    long long counts[VERIFY_CODES];
+    double seconds;  // mapping, indexing and checking
+    int threads;
+} VerifyReport;
+
+const char *verify_code_name(int code);
+int verify_record(const char *grid_text, int grid_length, const char *puzzle_text,
+                  int puzzle_length, int check_unique);
+long long verify_batch_file(const char *filename, int check_unique, VerifyReport *report,
+                            unsigned char **codes, unsigned int **lines);
+
+// Asynchronous solving (sudoku_async.c). Puzzles are submitted without
+// blocking and solved by a team of OpenMP threads the queue owns, one puzzle
+// per thread at a time (a parallel engine runs single threaded in there, so
+// the team never nests). Results come back through a callback, run on the
+// worker thread, or a completion queue the caller polls or waits on. On
+// POSIX the queue also has a file descriptor that is readable while
+// completions are waiting, for select()/poll()/epoll loops.
+typedef struct SolveQueue SolveQueue;
+
+typedef struct {
+    unsigned long long ticket;  // what solve_queue_submit() returned
+    void *tag;                  // passed through from the submission
+    int result;                 // 1, 0, SOLVE_TIMED_OUT or RESULT_INVALID
+    SudokuGrid grid;            // solved grid (or as far as it got)
+    SolverStats stats;
+    double submitted, started, finished;  // omp_get_wtime() values
+    int worker;                 // team thread that solved it
+} SolveCompletion;
+
+typedef void (*SolveCallback)(const SolveCompletion *done, void *context);
+
+#define SOLVE_QUEUE_CAPACITY 1024  // default puzzles in flight (submitted, not yet delivered)
+
+SolveQueue *solve_queue_create(int threads, int capacity, SolverFunc solve, const SolveLimits *limits,
+                               SolveCallback callback, void *context);
+unsigned long long solve_queue_submit(SolveQueue *queue, SudokuGrid *puzzle, void *tag);
+int solve_queue_submit_batch(SolveQueue *queue, SudokuGrid *puzzles, void **tags, int count,
+                             unsigned long long *tickets);
+int solve_queue_poll(SolveQueue *queue, SolveCompletion *done);
+int solve_queue_wait(SolveQueue *queue, SolveCompletion *done);
+int solve_queue_fd(SolveQueue *queue);
+int solve_queue_threads(SolveQueue *queue);
+void solve_queue_close(SolveQueue *queue);
+void solve_queue_destroy(SolveQueue *queue);
+
+// Latency histogram: bucket b counts latencies under 2^b microseconds (the
+// last one takes everything longer). Percentiles are bucket upper bounds,
+// so they're within a factor of 2 - enough to see a tail. latency_record()
+// only uses atomic adds, so any number of threads can record into one.
+#define LATENCY_BUCKETS 32
+
+typedef struct {
+    unsigned long long counts[LATENCY_BUCKETS];
+    unsigned long long total;
+    unsigned long long sum_ns, max_ns;
+} LatencyHistogram;
+
+void latency_record(LatencyHistogram *histogram, double seconds);
+double latency_percentile(const LatencyHistogram *histogram, double fraction);
+
+// Live metrics (sudoku_metrics.c) - process-wide counters fed by the solve
+// queue and the batch hybrid while they run: puzzles by result, nodes, the
+// technique counters of SolverStats, busy time per team thread and solve
+// latency. All updates are atomic adds, no locks. Exported as Prometheus
+// text; rates are over the time since the caller's previous snapshot.
+typedef struct {
+    double time;
+    unsigned long long puzzles, nodes;
+    unsigned long long busy_ns[MAX_THREADS];
+} MetricsSnapshot;
+
+#define METRICS_TEXT_SIZE 16384  // enough for a whole dump
+
+void metrics_start(void);
+void metrics_record_work(const SolverStats *after, const SolverStats *before, int thread, double busy);
+void metrics_record_puzzle(int result, double latency);
+int metrics_format_prometheus(char *out, int room, MetricsSnapshot *previous);
+int metrics_start_dumper(const char *path, double interval);
+void metrics_stop_dumper(void);
+
+// Solver daemon (sudoku_daemon.c, POSIX only). Serves '<81 chars>' lines on
+// a Unix domain socket with '<81 chars> <status>' in request order per
+// connection; 'STATS' gets the counters and latency histograms, 'METRICS'
+// the live metrics in Prometheus text format. Runs until
+// SIGINT/SIGTERM, returns the exit code.
+#define DAEMON_MAX_CLIENTS 256
+#define DAEMON_PIPELINE 64      // unanswered requests per connection before it stops being read
+#define DAEMON_MAX_REQUESTS 4096  // in flight over all connections (the solve queue's capacity)
+#define DAEMON_BATCH_MAX 256    // requests submitted to the team in one go
+
+int serve_unix_socket(const char *path, int threads, const SolverEngine *engine, const SolveLimits *limits);
+
+// Heuristics used by every engine unless a caller passes its own config
+extern SearchConfig search_config;
+
+#endif
@@ -0,0 +1,309 @@
+// Asynchronous solving - a submission queue in front of a team of OpenMP
+// threads, for callers that can't block a thread per puzzle (event loops,
+// servers).
+//
+// solve_queue_create() starts one host thread which opens the team and keeps
+// it until the queue is destroyed, so OpenMP start-up is paid once and the
+// team is the only set of solver threads there is. Every team thread takes
+// the next submitted puzzle, solves it with the queue's engine and delivers
+// it: to the callback if there is one, otherwise onto the completion queue.
+// Both rings are sized by the queue's capacity, which bounds the puzzles in
+// flight - a submit past that is refused instead of blocking.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+#include <pthread.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "sudoku_advanced.h"
+
+typedef struct {
+    unsigned long long ticket;
+    void *tag;
+    SudokuGrid grid;
+    double submitted;
+} SolveJob;
+
+struct SolveQueue {
+    SolverFunc solve;
+    SolveLimits limits;
+    SolveCallback callback;
+    void *context;
+    int threads;
+    int capacity;
+
+    pthread_t host;
+    pthread_mutex_t lock;
+    pthread_cond_t work;      // a job was submitted, or the queue closed
+    pthread_cond_t done;      // a completion was queued, or the last job finished
+
+    SolveJob *jobs;           // submitted, not started (ring)
+    int job_head, job_count;
+    SolveCompletion *results; // finished, not collected (ring, no callback only)
+    int result_head, result_count;
+    int outstanding;          // submitted and not yet delivered
+    unsigned long long next_ticket;
+    int closing;
+    int notify[2];            // pipe, readable while results is non-empty (-1 on Windows)
+};
+
+static void solve_job(SolveQueue *queue, SolveJob *job, SolveCompletion *done) {
+    done->ticket = job->ticket;
+    done->tag = job->tag;
+    done->submitted = job->submitted;
+    done->worker = omp_get_thread_num();
+    done->started = omp_get_wtime();
+    copy_grid(&job->grid, &done->grid);
+    if (check_givens(&done->grid)) {
+        done->result = queue->solve(&done->grid, &done->stats, &queue->limits);
+    } else {
+        memset(&done->stats, 0, sizeof(SolverStats));
+        done->result = RESULT_INVALID;
+    }
+    done->finished = omp_get_wtime();
+}
+
+// Run by every thread of the team until the queue is closed and empty
+static void serve_jobs(SolveQueue *queue) {
+    SolveJob job;
+    SolveCompletion done;
+
+    for (;;) {
+        pthread_mutex_lock(&queue->lock);
+        while (queue->job_count == 0 && !queue->closing) {
+            pthread_cond_wait(&queue->work, &queue->lock);
+        }
+        if (queue->job_count == 0) {
+            pthread_mutex_unlock(&queue->lock);
+            return;
+        }
+        job = queue->jobs[queue->job_head];
+        queue->job_head = (queue->job_head + 1) % queue->capacity;
+        queue->job_count--;
+        pthread_mutex_unlock(&queue->lock);
+
+        solve_job(queue, &job, &done);
+        metrics_record_work(&done.stats, NULL, done.worker, done.finished - done.started);
+        metrics_record_puzzle(done.result, done.finished - done.submitted);
+
+        if (queue->callback) {
+            queue->callback(&done, queue->context);
+            pthread_mutex_lock(&queue->lock);
+            queue->outstanding--;
+        } else {
+            pthread_mutex_lock(&queue->lock);
+            int tail = (queue->result_head + queue->result_count) % queue->capacity;
+            queue->results[tail] = done;
+#ifndef _WIN32
+            // The pipe holds one byte while the completion queue isn't empty
+            char byte = 1;
+            if (queue->result_count == 0 && write(queue->notify[1], &byte, 1) < 0) {
+                perror("solve queue notify");
+            }
+#endif
+            queue->result_count++;
+        }
+        pthread_cond_broadcast(&queue->done);
+        pthread_mutex_unlock(&queue->lock);
+    }
+}
+
+static void *host_team(void *arg) {
+    SolveQueue *queue = arg;
+    // An engine with its own parallel region gets one thread in here
+    omp_set_max_active_levels(1);
+    #pragma omp parallel num_threads(queue->threads)
+    serve_jobs(queue);
+    return NULL;
+}
+
+// threads 0 = omp_get_max_threads(), capacity 0 = SOLVE_QUEUE_CAPACITY,
+// limits NULL = none. With a callback, completions go only to it (called on
+// a team thread, so it has to be thread safe and shouldn't block for long).
+// Returns NULL if the queue or its team couldn't be set up.
+SolveQueue *solve_queue_create(int threads, int capacity, SolverFunc solve, const SolveLimits *limits,
+                               SolveCallback callback, void *context) {
+    SolveQueue *queue = calloc(1, sizeof(SolveQueue));
+    if (!queue) return NULL;
+    metrics_start();
+    if (threads <= 0) threads = omp_get_max_threads();
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    if (capacity <= 0) capacity = SOLVE_QUEUE_CAPACITY;
+
+    queue->solve = solve;
+    if (limits) queue->limits = *limits;
+    queue->callback = callback;
+    queue->context = context;
+    queue->threads = threads;
+    queue->capacity = capacity;
+    queue->jobs = malloc(capacity * sizeof(SolveJob));
+    queue->results = callback ? NULL : malloc(capacity * sizeof(SolveCompletion));
+    queue->notify[0] = queue->notify[1] = -1;
+    if (!queue->jobs || (!callback && !queue->results)) {
+        free(queue->jobs);
+        free(queue->results);
+        free(queue);
+        return NULL;
+    }
+
+#ifndef _WIN32
+    if (!callback) {
+        if (pipe(queue->notify) < 0) {
+            free(queue->jobs);
+            free(queue->results);
+            free(queue);
+            return NULL;
+        }
+        fcntl(queue->notify[0], F_SETFL, O_NONBLOCK);
+        fcntl(queue->notify[1], F_SETFL, O_NONBLOCK);
+    }
+#endif
+
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->work, NULL);
+    pthread_cond_init(&queue->done, NULL);
+    if (pthread_create(&queue->host, NULL, host_team, queue) != 0) {
+        queue->closing = 1;
+        queue->threads = 0;
+        solve_queue_destroy(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+// Copies the puzzle in and returns straight away with a ticket (counting up
+// from 1), or 0 if the queue is closed or already has capacity puzzles in
+// flight - collect some completions and try again.
+unsigned long long solve_queue_submit(SolveQueue *queue, SudokuGrid *puzzle, void *tag) {
+    unsigned long long ticket = 0;
+    pthread_mutex_lock(&queue->lock);
+    if (!queue->closing && queue->outstanding < queue->capacity) {
+        int tail = (queue->job_head + queue->job_count) % queue->capacity;
+        SolveJob *job = &queue->jobs[tail];
+        ticket = ++queue->next_ticket;
+        job->ticket = ticket;
+        job->tag = tag;
+        job->submitted = omp_get_wtime();
+        copy_grid(puzzle, &job->grid);
+        queue->job_count++;
+        queue->outstanding++;
+        pthread_cond_signal(&queue->work);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return ticket;
+}
+
+// Same for puzzles[0..count) under one lock, with one wake-up of the team
+// for the lot. Takes as many as fit in order, sets their tickets and returns
+// how many that was.
+int solve_queue_submit_batch(SolveQueue *queue, SudokuGrid *puzzles, void **tags, int count,
+                             unsigned long long *tickets) {
+    int taken = 0;
+    pthread_mutex_lock(&queue->lock);
+    double now = omp_get_wtime();
+    while (!queue->closing && taken < count && queue->outstanding < queue->capacity) {
+        int tail = (queue->job_head + queue->job_count) % queue->capacity;
+        SolveJob *job = &queue->jobs[tail];
+        job->ticket = ++queue->next_ticket;
+        job->tag = tags ? tags[taken] : NULL;
+        job->submitted = now;
+        copy_grid(&puzzles[taken], &job->grid);
+        if (tickets) tickets[taken] = job->ticket;
+        queue->job_count++;
+        queue->outstanding++;
+        taken++;
+    }
+    if (taken == 1) pthread_cond_signal(&queue->work);
+    else if (taken) pthread_cond_broadcast(&queue->work);
+    pthread_mutex_unlock(&queue->lock);
+    return taken;
+}
+
+// Takes the oldest completion off the queue; call with the lock held
+static void take_completion(SolveQueue *queue, SolveCompletion *done) {
+    *done = queue->results[queue->result_head];
+    queue->result_head = (queue->result_head + 1) % queue->capacity;
+    queue->result_count--;
+    queue->outstanding--;
+#ifndef _WIN32
+    char byte;
+    if (queue->result_count == 0 && read(queue->notify[0], &byte, 1) < 0) {
+        perror("solve queue notify");
+    }
+#endif
+    if (queue->outstanding == 0) pthread_cond_broadcast(&queue->done);
+}
+
+// 1 and the oldest completion if one is waiting, 0 right away if not
+// (always 0 with a callback)
+int solve_queue_poll(SolveQueue *queue, SolveCompletion *done) {
+    int found = 0;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->result_count) {
+        take_completion(queue, done);
+        found = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+// Blocks until a completion is waiting (returns 1) or nothing is in flight
+// any more (returns 0). With a callback it just waits for the queue to drain.
+int solve_queue_wait(SolveQueue *queue, SolveCompletion *done) {
+    int found = 0;
+    pthread_mutex_lock(&queue->lock);
+    while (queue->result_count == 0 && queue->outstanding > 0) {
+        pthread_cond_wait(&queue->done, &queue->lock);
+    }
+    if (queue->result_count) {
+        take_completion(queue, done);
+        found = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+// Readable while completions are waiting; -1 with a callback or on Windows.
+// Don't read it yourself - solve_queue_poll() keeps it in step.
+int solve_queue_fd(SolveQueue *queue) {
+    return queue->notify[0];
+}
+
+int solve_queue_threads(SolveQueue *queue) {
+    return queue->threads;
+}
+
+// No more submissions. Puzzles already submitted are still solved.
+void solve_queue_close(SolveQueue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    queue->closing = 1;
+    pthread_cond_broadcast(&queue->work);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+// Closes the queue, waits for the team to finish what was submitted and frees
+// everything. Completions nobody collected are dropped.
+void solve_queue_destroy(SolveQueue *queue) {
+    if (!queue) return;
+    solve_queue_close(queue);
+    if (queue->threads) pthread_join(queue->host, NULL);
+
+    pthread_cond_destroy(&queue->done);
+    pthread_cond_destroy(&queue->work);
+    pthread_mutex_destroy(&queue->lock);
+#ifndef _WIN32
+    if (queue->notify[0] >= 0) {
+        close(queue->notify[0]);
+        close(queue->notify[1]);
+    }
+#endif
+    free(queue->results);
+    free(queue->jobs);
+    free(queue);
+}
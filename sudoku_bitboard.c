@@ -0,0 +1,316 @@
+// Bitboard engine - the digit-major band layout used by the fastest known
+// solvers (JCZSolve and friends), on top of the same SudokuGrid, SolverStats,
+// SolveLimits and verification as sudoku_advanced.c.
+//
+// For every digit the 81 possible positions are three 27-bit words, one per
+// band (3 rows x 9 columns, bit = row_in_band * 9 + col). Placing a digit
+// clears its peers with three ANDs, and propagation works on whole words:
+//  - band_locked[] keeps only the minirows a row -> box permutation can still
+//    use, which is pointing pairs and box/line claims in one table lookup
+//    (and the same again for columns x bands inside each stack)
+//  - naked singles come from bit-slicing the nine digit words of a band
+//  - hidden singles are rows/columns/boxes whose word has a single bit left
+// The board is 120 bytes, so the search just copies it at every branch.
+
+#include <stdio.h>
+#include <string.h>
+#include <omp.h>
+
+#include "sudoku_advanced.h"
+#include "sudoku_tables.h"
+
+typedef struct {
+    unsigned int pos[N][3];    // where digit d can go, per band; placed cells keep their bit
+    unsigned int unsolved[3];  // cells not placed yet, per band
+} BitBoard;
+
+typedef struct {
+    BitBoard board;
+    unsigned short digits;  // untried digits for cell (bit d = digit d + 1)
+    unsigned char cell;
+} BitNode;
+
+#define COLUMN_CELLS 0x0040201  // column 0 of a band: bits 0, 9 and 18
+#define STACK_CELLS  0x01C0E07  // columns 0-2 of a band
+#define ROW_CELLS    0x00001FF  // row 0 of a band
+
+// 3 column bits of a stack -> the band cells of those columns
+static const unsigned int stack_columns[8] = {
+    0x0000000, 0x0040201, 0x0080402, 0x00C0603, 0x0100804, 0x0140A05, 0x0180C06, 0x01C0E07
+};
+
+static void bb_place(BitBoard *bb, int d, int cell) {
+    int band = cell / BAND_CELLS;
+    unsigned int bit = 1u << (cell % BAND_CELLS);
+
+    bb->pos[d][0] &= ~band_peers[cell][0];
+    bb->pos[d][1] &= ~band_peers[cell][1];
+    bb->pos[d][2] &= ~band_peers[cell][2];
+    for (int e = 0; e < N; e++) {
+        if (e != d) bb->pos[e][band] &= ~bit;
+    }
+    bb->unsolved[band] &= ~bit;
+}
+
+// Returns 0 if the givens already clash
+static int bb_load(BitBoard *bb, SudokuGrid *grid) {
+    for (int d = 0; d < N; d++) {
+        bb->pos[d][0] = bb->pos[d][1] = bb->pos[d][2] = BAND_MASK;
+    }
+    bb->unsolved[0] = bb->unsolved[1] = bb->unsolved[2] = BAND_MASK;
+
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        int value = grid->cells[cell_row[cell]][cell_col[cell]];
+        if (value == UNASSIGNED) continue;
+
+        int d = value - 1;
+        if (!(bb->pos[d][cell / BAND_CELLS] & (1u << (cell % BAND_CELLS)))) {
+            return 0;
+        }
+        bb_place(bb, d, cell);
+    }
+    return 1;
+}
+
+static void bb_store(BitBoard *bb, SudokuGrid *grid) {
+    for (int cell = 0; cell < NUM_CELLS; cell++) {
+        int band = cell / BAND_CELLS;
+        unsigned int bit = 1u << (cell % BAND_CELLS);
+        int value = UNASSIGNED;
+
+        if (!(bb->unsolved[band] & bit)) {
+            for (int d = 0; d < N; d++) {
+                if (bb->pos[d][band] & bit) {
+                    value = d + 1;
+                    break;
+                }
+            }
+        }
+        grid->cells[cell_row[cell]][cell_col[cell]] = value;
+    }
+    init_candidates(grid);
+}
+
+// Locked candidates for one digit, rows x boxes inside each band and columns
+// x bands inside each stack. Returns 0 on a dead end.
+static int bb_locked(BitBoard *bb, int d, SolverStats *stats) {
+    unsigned int *pos = bb->pos[d];
+
+    for (int b = 0; b < 3; b++) {
+        unsigned int p = pos[b];
+        int minirows = row_boxes[p & ROW_CELLS] | row_boxes[(p >> 9) & ROW_CELLS] << 3 |
+                       row_boxes[p >> 18] << 6;
+        int allowed = band_locked[minirows];
+        if (!allowed) return 0;
+        if (allowed != minirows) {
+            pos[b] = p & minirow_cells[allowed];
+            stats->pointing_pairs_found++;
+        }
+    }
+
+    for (int s = 0; s < 3; s++) {
+        int minicols = 0;
+        for (int b = 0; b < 3; b++) {
+            unsigned int p = pos[b];
+            minicols |= (((p | p >> 9 | p >> 18) >> (3 * s)) & 7) << (3 * b);
+        }
+        int allowed = band_locked[minicols];
+        if (!allowed) return 0;
+        if (allowed != minicols) {
+            for (int b = 0; b < 3; b++) {
+                unsigned int keep = stack_columns[(allowed >> (3 * b)) & 7] << (3 * s);
+                pos[b] &= ~(STACK_CELLS << (3 * s)) | keep;
+            }
+            stats->box_line_reductions++;
+        }
+    }
+    return 1;
+}
+
+// Cells with one candidate left. Returns 0 on a dead end.
+static int bb_naked_singles(BitBoard *bb, SolverStats *stats) {
+    for (int b = 0; b < 3; b++) {
+        unsigned int one = 0, two = 0;
+        for (int d = 0; d < N; d++) {
+            unsigned int p = bb->pos[d][b];
+            two |= one & p;
+            one |= p;
+        }
+        if (bb->unsolved[b] & ~one) return 0;  // a cell with no candidates
+
+        unsigned int singles = bb->unsolved[b] & ~two;
+        while (singles) {
+            unsigned int bit = singles & -singles;
+            singles &= singles - 1;
+
+            // An earlier single of this band may have taken the last candidate
+            int d = 0;
+            while (d < N && !(bb->pos[d][b] & bit)) d++;
+            if (d == N) return 0;
+
+            bb_place(bb, d, b * BAND_CELLS + __builtin_ctz(bit));
+            stats->naked_singles_found++;
+        }
+    }
+    return 1;
+}
+
+// Rows, boxes and columns where the digit has a single unsolved cell left
+static void bb_hidden_singles(BitBoard *bb, int d, SolverStats *stats) {
+    unsigned int *pos = bb->pos[d];
+
+    for (int b = 0; b < 3; b++) {
+        for (int u = 0; u < 6; u++) {
+            // u 0-2 are the band's rows, 3-5 its boxes
+            unsigned int mask = u < 3 ? ROW_CELLS << (9 * u) : STACK_CELLS << (3 * (u - 3));
+            unsigned int x = pos[b] & mask;
+            if (x && !(x & (x - 1)) && (x & bb->unsolved[b])) {
+                bb_place(bb, d, b * BAND_CELLS + __builtin_ctz(x));
+                stats->hidden_singles_found++;
+            }
+        }
+    }
+
+    for (int c = 0; c < N; c++) {
+        unsigned int column = COLUMN_CELLS << c;
+        unsigned int x0 = pos[0] & column, x1 = pos[1] & column, x2 = pos[2] & column;
+        if (__builtin_popcount(x0) + __builtin_popcount(x1) + __builtin_popcount(x2) != 1) continue;
+
+        int b = x0 ? 0 : x1 ? 1 : 2;
+        unsigned int x = x0 | x1 | x2;
+        if (x & bb->unsolved[b]) {
+            bb_place(bb, d, b * BAND_CELLS + __builtin_ctz(x));
+            stats->hidden_singles_found++;
+        }
+    }
+}
+
+// Everything to a fixpoint. 1 = solved, 0 = open, -1 = dead end.
+static int bb_propagate(BitBoard *bb, SolverStats *stats) {
+    for (;;) {
+        BitBoard before = *bb;
+
+        for (int d = 0; d < N; d++) {
+            if (!bb_locked(bb, d, stats)) return -1;
+        }
+        if (!bb_naked_singles(bb, stats)) return -1;
+        for (int d = 0; d < N; d++) {
+            bb_hidden_singles(bb, d, stats);
+        }
+
+        if (memcmp(&before, bb, sizeof(BitBoard)) == 0) break;
+    }
+
+    if ((bb->unsolved[0] | bb->unsolved[1] | bb->unsolved[2]) == 0) return 1;
+    return 0;
+}
+
+// First bivalue cell if there is one, else the unsolved cell with the fewest candidates
+static int bb_branch_cell(const BitBoard *bb) {
+    for (int b = 0; b < 3; b++) {
+        unsigned int one = 0, two = 0, three = 0;
+        for (int d = 0; d < N; d++) {
+            unsigned int p = bb->pos[d][b];
+            three |= two & p;
+            two |= one & p;
+            one |= p;
+        }
+        unsigned int pairs = two & ~three & bb->unsolved[b];
+        if (pairs) return b * BAND_CELLS + __builtin_ctz(pairs);
+    }
+
+    int best = -1, best_count = N + 1;
+    for (int b = 0; b < 3; b++) {
+        unsigned int open = bb->unsolved[b];
+        while (open) {
+            unsigned int bit = open & -open;
+            open &= open - 1;
+
+            int count = 0;
+            for (int d = 0; d < N; d++) count += (bb->pos[d][b] & bit) != 0;
+            if (count < best_count) {
+                best_count = count;
+                best = b * BAND_CELLS + __builtin_ctz(bit);
+            }
+        }
+    }
+    return best;
+}
+
+static unsigned short bb_cell_digits(const BitBoard *bb, int cell) {
+    int band = cell / BAND_CELLS;
+    unsigned int bit = 1u << (cell % BAND_CELLS);
+    unsigned short digits = 0;
+    for (int d = 0; d < N; d++) {
+        if (bb->pos[d][band] & bit) digits |= 1 << d;
+    }
+    return digits;
+}
+
+// Same explicit-stack DFS as solve_iterative(). On SEARCH_OVER_BUDGET board
+// is left as the propagated root.
+static int bb_search(BitBoard *board, SolverStats *stats, SolveBudget *budget) {
+    BitNode nodes[MAX_SEARCH_DEPTH];
+    BitBoard root = *board;
+    int top = 0;
+    unsigned long long since_check = 0, check_every = BUDGET_CHECK_INTERVAL;
+    if (budget && budget->max_nodes && budget->max_nodes < check_every) {
+        check_every = budget->max_nodes;
+    }
+
+    for (;;) {
+        stats->nodes_explored++;
+        int state = bb_propagate(board, stats);
+        if (state == 1) return 1;
+        if (stats->nodes_explored == 1) root = *board;
+
+        if (state == 0) {
+            BitNode *node = &nodes[top++];
+            node->board = *board;
+            node->cell = bb_branch_cell(board);
+            node->digits = bb_cell_digits(board, node->cell);
+        }
+
+        while (top > 0 && nodes[top - 1].digits == 0) {
+            top--;
+        }
+        if (top == 0) return 0;
+
+        if (budget && ++since_check >= check_every) {
+            since_check = 0;
+            if (budget_expired(budget, check_every)) {
+                *board = root;
+                return SEARCH_OVER_BUDGET;
+            }
+        }
+
+        BitNode *parent = &nodes[top - 1];
+        int d = __builtin_ctz(parent->digits);
+        parent->digits &= parent->digits - 1;
+
+        *board = parent->board;
+        bb_place(board, d, parent->cell);
+        stats->backtrack_count++;
+    }
+}
+
+int solve_bitboard(SudokuGrid *grid, SolverStats *stats, const SolveLimits *limits) {
+    memset(stats, 0, sizeof(SolverStats));
+
+    double start = omp_get_wtime();
+    SolveBudget budget;
+    SolveBudget *shared_budget = budget_init(&budget, limits, start);
+
+    BitBoard board;
+    int result = 0;
+    if (bb_load(&board, grid)) {
+        result = bb_search(&board, stats, shared_budget);
+        if (result != 0) bb_store(&board, grid);
+    }
+
+    stats->timed_out = result == SOLVE_TIMED_OUT;
+    stats->time_taken = omp_get_wtime() - start;
+    stats->search_time = stats->time_taken;
+    stats->threads_used = 1;
+    return result;
+}
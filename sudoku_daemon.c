@@ -0,0 +1,454 @@
+// Solver daemon - a long-running process on a Unix domain socket, so a
+// client pays neither process start-up nor OpenMP team start-up per puzzle.
+//
+// Protocol, one line each way:
+//   <81 chars, '.' or '0' for empty>  ->  <81 chars> <solved|unsolvable|timeout|invalid|bad_format>
+//   STATS                             ->  '# ...' lines, ending with '# end'
+//   METRICS                           ->  live metrics (Prometheus text), ending with '# EOF'
+// A connection can pipeline requests; answers come back in request order.
+//
+// One thread runs the event loop (poll() over the listening socket, the
+// connections and the solve queue's fd). Every round it takes all complete
+// lines that have arrived on any connection and hands them to the team as
+// one micro-batch (solve_queue_submit_batch(): one lock, one wake-up), then
+// writes back whatever the team has finished. Under load the batches grow
+// by themselves; a lone request still goes out on its own right away.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#include "sudoku_advanced.h"
+
+#ifdef _WIN32
+
+int serve_unix_socket(const char *path, int threads, const SolverEngine *engine, const SolveLimits *limits) {
+    (void)path;
+    (void)threads;
+    (void)engine;
+    (void)limits;
+    printf("Error: serve needs Unix domain sockets (not available in this build)\n");
+    return 1;
+}
+
+#else
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define CLIENT_INPUT 4096
+#define RESPONSE_LENGTH (N * N + 16)
+
+enum { SLOT_EMPTY, SLOT_READY, SLOT_STATS, SLOT_METRICS };
+
+typedef struct {
+    int fd;                     // -1 = free
+    unsigned int generation;    // bumped on every accept, so late completions for a closed connection are dropped
+    int eof;                    // client is done sending, close once everything is answered
+    int discarding;             // skipping the rest of an overlong line
+    char input[CLIENT_INPUT];
+    int input_length;
+    char *output;
+    int output_length, output_capacity;
+    unsigned int next_seq;      // sequence number of the next request
+    unsigned int flush_seq;     // next answer to write
+    struct {
+        char state;
+        char line[RESPONSE_LENGTH];
+    } slots[DAEMON_PIPELINE];
+} DaemonClient;
+
+typedef struct {
+    int client;
+    unsigned int generation;
+    unsigned int seq;
+    double received;
+    int next_free;
+} DaemonRequest;
+
+typedef struct {
+    unsigned long long requests, bad_requests, connections;
+    unsigned long long results[4];  // solved, unsolvable, timeout, invalid
+    unsigned long long batches, batched, max_batch;
+    unsigned long long nodes;
+    LatencyHistogram total;   // line read -> answer queued for writing
+    LatencyHistogram queued;  // submitted -> a team thread picked it up
+    LatencyHistogram solve;
+    double started;
+    MetricsSnapshot metrics;  // as of the last METRICS request
+} DaemonStats;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void request_stop(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static const char *result_names[4] = { "solved", "unsolvable", "timeout", "invalid" };
+
+static int result_index(int result) {
+    return result == 1 ? 0 : result == SOLVE_TIMED_OUT ? 2 : result == RESULT_INVALID ? 3 : 1;
+}
+
+static void append_output(DaemonClient *client, const char *text, int length) {
+    if (client->output_length + length > client->output_capacity) {
+        int capacity = client->output_capacity ? client->output_capacity : 4096;
+        while (capacity < client->output_length + length) capacity *= 2;
+        char *output = realloc(client->output, capacity);
+        if (!output) {
+            printf("Error: Out of memory for a connection's output\n");
+            exit(1);
+        }
+        client->output = output;
+        client->output_capacity = capacity;
+    }
+    memcpy(client->output + client->output_length, text, length);
+    client->output_length += length;
+}
+
+static int format_histogram(char *out, int room, const char *name, const LatencyHistogram *h) {
+    int length = snprintf(out, room, "# latency_us %s count=%llu mean=%.1f p50=%.0f p90=%.0f p99=%.0f max=%.1f\n",
+                          name, h->total, h->total ? 1e-3 * h->sum_ns / h->total : 0.0,
+                          1e6 * latency_percentile(h, 0.5), 1e6 * latency_percentile(h, 0.9),
+                          1e6 * latency_percentile(h, 0.99), 1e-3 * h->max_ns);
+    // Buckets as '<upper bound us>:count', empty ones left out
+    length += snprintf(out + length, room - length, "# histogram_us %s", name);
+    for (int b = 0; b < LATENCY_BUCKETS && length < room; b++) {
+        if (!h->counts[b]) continue;
+        if (b == LATENCY_BUCKETS - 1) length += snprintf(out + length, room - length, " inf:%llu", h->counts[b]);
+        else length += snprintf(out + length, room - length, " %llu:%llu", 1ULL << b, h->counts[b]);
+    }
+    if (length < room) length += snprintf(out + length, room - length, "\n");
+    return length < room ? length : room - 1;
+}
+
+static int format_stats(char *out, int room, DaemonStats *stats, int clients, int in_flight, int threads) {
+    double uptime = omp_get_wtime() - stats->started;
+    int length = snprintf(out, room,
+                          "# uptime_s=%.3f threads=%d connections=%d/%llu in_flight=%d\n"
+                          "# requests=%llu solved=%llu unsolvable=%llu timeout=%llu invalid=%llu bad_format=%llu\n"
+                          "# batches=%llu mean_batch=%.2f max_batch=%llu nodes=%llu solves_per_s=%.0f\n",
+                          uptime, threads, clients, stats->connections, in_flight,
+                          stats->requests, stats->results[0], stats->results[1], stats->results[2],
+                          stats->results[3], stats->bad_requests, stats->batches,
+                          stats->batches ? (double)stats->batched / stats->batches : 0.0, stats->max_batch,
+                          stats->nodes, uptime > 0 ? stats->total.total / uptime : 0.0);
+    length += format_histogram(out + length, room - length, "total", &stats->total);
+    length += format_histogram(out + length, room - length, "queued", &stats->queued);
+    length += format_histogram(out + length, room - length, "solve", &stats->solve);
+    length += snprintf(out + length, room - length, "# end\n");
+    return length < room ? length : room - 1;
+}
+
+static int open_socket(const char *path) {
+    struct sockaddr_un address;
+    if (strlen(path) >= sizeof(address.sun_path)) {
+        printf("Error: Socket path %s is too long\n", path);
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(fd, 128) < 0) {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    return fd;
+}
+
+static void close_client(DaemonClient *client, int *open_clients) {
+    close(client->fd);
+    client->fd = -1;
+    free(client->output);
+    client->output = NULL;
+    client->output_length = client->output_capacity = 0;
+    (*open_clients)--;
+}
+
+// Requests this connection may still have in flight
+static int client_room(DaemonClient *client) {
+    return DAEMON_PIPELINE - (int)(client->next_seq - client->flush_seq);
+}
+
+// No newline in a full buffer: not a request, answer it and skip the rest
+// of the line. Needs room in the pipeline.
+static void reject_overlong(DaemonClient *client, DaemonStats *stats) {
+    unsigned int seq = client->next_seq++;
+    snprintf(client->slots[seq % DAEMON_PIPELINE].line, RESPONSE_LENGTH, "%.*s bad_format\n",
+             N * N, client->input);
+    client->slots[seq % DAEMON_PIPELINE].state = SLOT_READY;
+    client->input_length = 0;
+    client->discarding = 1;
+    stats->requests++;
+    stats->bad_requests++;
+}
+
+// Moves the answers that are next in line to the output buffer and writes
+// as much as the socket takes. Returns 0 if the connection broke.
+static int flush_client(DaemonClient *client, DaemonStats *stats, int clients, int in_flight, int threads) {
+    static char text[METRICS_TEXT_SIZE];
+    while (client->flush_seq != client->next_seq) {
+        int slot = client->flush_seq % DAEMON_PIPELINE;
+        if (client->slots[slot].state == SLOT_EMPTY) break;
+        if (client->slots[slot].state == SLOT_STATS) {
+            append_output(client, text, format_stats(text, sizeof(text), stats, clients, in_flight, threads));
+        } else if (client->slots[slot].state == SLOT_METRICS) {
+            append_output(client, text, metrics_format_prometheus(text, sizeof(text), &stats->metrics));
+            append_output(client, "# EOF\n", 6);
+        } else {
+            append_output(client, client->slots[slot].line, strlen(client->slots[slot].line));
+        }
+        client->slots[slot].state = SLOT_EMPTY;
+        client->flush_seq++;
+    }
+
+    if (client->output_length) {
+        ssize_t written = write(client->fd, client->output, client->output_length);
+        if (written < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        memmove(client->output, client->output + written, client->output_length - written);
+        client->output_length -= written;
+    }
+    return 1;
+}
+
+int serve_unix_socket(const char *path, int threads, const SolverEngine *engine, const SolveLimits *limits) {
+    int listen_fd = open_socket(path);
+    if (listen_fd < 0) return 1;
+
+    SolveQueue *queue = solve_queue_create(threads, DAEMON_MAX_REQUESTS, engine->solve, limits, NULL, NULL);
+    DaemonClient *clients = calloc(DAEMON_MAX_CLIENTS, sizeof(DaemonClient));
+    DaemonRequest *requests = malloc(DAEMON_MAX_REQUESTS * sizeof(DaemonRequest));
+    SudokuGrid *batch = malloc(DAEMON_BATCH_MAX * sizeof(SudokuGrid));
+    struct pollfd *fds = malloc((DAEMON_MAX_CLIENTS + 2) * sizeof(struct pollfd));
+    if (!queue || !clients || !requests || !batch || !fds) {
+        printf("Error: Could not start the solve queue\n");
+        solve_queue_destroy(queue);
+        free(fds);
+        free(batch);
+        free(requests);
+        free(clients);
+        close(listen_fd);
+        unlink(path);
+        return 1;
+    }
+
+    for (int c = 0; c < DAEMON_MAX_CLIENTS; c++) clients[c].fd = -1;
+    int free_request = 0;
+    for (int r = 0; r < DAEMON_MAX_REQUESTS; r++) requests[r].next_free = r + 1 < DAEMON_MAX_REQUESTS ? r + 1 : -1;
+
+    DaemonStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.started = omp_get_wtime();
+    int open_clients = 0, in_flight = 0, next_client = 0;
+    int team = solve_queue_threads(queue);
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, request_stop);
+    signal(SIGTERM, request_stop);
+    printf("# serving on %s, engine=%s threads=%d\n", path, engine->name, team);
+    fflush(stdout);
+
+    int backlog = 0;  // complete lines left in input buffers last round
+    while (!stop_requested) {
+        // Poll set: listening socket, solve queue, then the connections
+        int nfds = 0, client_of[DAEMON_MAX_CLIENTS + 2];
+        fds[nfds].fd = listen_fd;
+        fds[nfds++].events = open_clients < DAEMON_MAX_CLIENTS ? POLLIN : 0;
+        fds[nfds].fd = solve_queue_fd(queue);
+        fds[nfds++].events = POLLIN;
+        for (int c = 0; c < DAEMON_MAX_CLIENTS; c++) {
+            DaemonClient *client = &clients[c];
+            short events = 0;
+            if (client->fd < 0) continue;
+            if (!client->eof && client->input_length < CLIENT_INPUT) events |= POLLIN;
+            if (client->output_length) events |= POLLOUT;
+            if (!events) continue;  // a closed peer would report POLLHUP every round
+            client_of[nfds] = c;
+            fds[nfds].fd = client->fd;
+            fds[nfds++].events = events;
+        }
+
+        if (poll(fds, nfds, backlog ? 0 : -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("poll");
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd;
+            while (open_clients < DAEMON_MAX_CLIENTS && (fd = accept(listen_fd, NULL, NULL)) >= 0) {
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+                while (clients[next_client].fd >= 0) next_client = (next_client + 1) % DAEMON_MAX_CLIENTS;
+                DaemonClient *client = &clients[next_client];
+                unsigned int generation = client->generation + 1;
+                memset(client, 0, sizeof(DaemonClient));
+                client->fd = fd;
+                client->generation = generation;
+                open_clients++;
+                stats.connections++;
+            }
+        }
+
+        for (int i = 2; i < nfds; i++) {
+            DaemonClient *client = &clients[client_of[i]];
+            if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                ssize_t got = read(client->fd, client->input + client->input_length,
+                                   CLIENT_INPUT - client->input_length);
+                if (got > 0) client->input_length += got;
+                else if (got == 0 || (errno != EAGAIN && errno != EINTR)) client->eof = 1;
+            }
+        }
+
+        // Micro-batch: every complete line on every connection, as far as
+        // the batch, the request pool and each connection's pipeline allow
+        int count = 0;
+        void *tags[DAEMON_BATCH_MAX];
+        double now = omp_get_wtime();
+        for (int k = 0; k < DAEMON_MAX_CLIENTS; k++) {
+            DaemonClient *client = &clients[k];
+            if (client->fd < 0) continue;
+            int pos = 0;
+
+            while (pos < client->input_length) {
+                char *start = client->input + pos;
+                char *end = memchr(start, '\n', client->input_length - pos);
+                if (!end) break;
+                if (count == DAEMON_BATCH_MAX || free_request < 0 || client_room(client) == 0) break;
+                int length = end - start;
+                pos += length + 1;
+                if (length && start[length - 1] == '\r') length--;
+                if (client->discarding) {
+                    client->discarding = 0;
+                    continue;
+                }
+                if (length == 0) continue;
+
+                unsigned int seq = client->next_seq++;
+                int slot = seq % DAEMON_PIPELINE;
+                stats.requests++;
+                if (length == 5 && strncmp(start, "STATS", 5) == 0) {
+                    client->slots[slot].state = SLOT_STATS;
+                } else if (length == 7 && strncmp(start, "METRICS", 7) == 0) {
+                    client->slots[slot].state = SLOT_METRICS;
+                } else if (length != N * N || !parse_puzzle_line(start, &batch[count])) {
+                    snprintf(client->slots[slot].line, RESPONSE_LENGTH, "%.*s bad_format\n",
+                             length < N * N ? length : N * N, start);
+                    client->slots[slot].state = SLOT_READY;
+                    stats.bad_requests++;
+                } else {
+                    int r = free_request;
+                    free_request = requests[r].next_free;
+                    requests[r].client = k;
+                    requests[r].generation = client->generation;
+                    requests[r].seq = seq;
+                    requests[r].received = now;
+                    tags[count++] = &requests[r];
+                }
+            }
+
+            memmove(client->input, client->input + pos, client->input_length - pos);
+            client->input_length -= pos;
+            // A full buffer that still has lines in it only stopped because the
+            // batch, the pool or the pipeline did; those wait for the next round
+            int overlong = client->input_length == CLIENT_INPUT &&
+                           !memchr(client->input, '\n', client->input_length);
+            if (overlong && client->discarding) {
+                client->input_length = 0;
+            } else if (overlong && client_room(client)) {
+                reject_overlong(client, &stats);
+            }
+        }
+        if (count) {
+            // The pool is as big as the queue, so it always takes all of them
+            int taken = solve_queue_submit_batch(queue, batch, tags, count, NULL);
+            in_flight += taken;
+            stats.batches++;
+            stats.batched += taken;
+            if ((unsigned long long)taken > stats.max_batch) stats.max_batch = taken;
+        }
+
+        SolveCompletion done;
+        while (solve_queue_poll(queue, &done)) {
+            DaemonRequest *request = done.tag;
+            DaemonClient *client = &clients[request->client];
+            double finished = omp_get_wtime();
+            in_flight--;
+            stats.results[result_index(done.result)]++;
+            stats.nodes += done.stats.nodes_explored;
+            latency_record(&stats.total, finished - request->received);
+            latency_record(&stats.queued, done.started - done.submitted);
+            latency_record(&stats.solve, done.finished - done.started);
+
+            if (client->fd >= 0 && client->generation == request->generation) {
+                int slot = request->seq % DAEMON_PIPELINE;
+                char line[N * N + 1];
+                format_puzzle_line(&done.grid, line);
+                snprintf(client->slots[slot].line, RESPONSE_LENGTH, "%s %s\n", line,
+                         result_names[result_index(done.result)]);
+                client->slots[slot].state = SLOT_READY;
+            }
+            request->next_free = free_request;
+            free_request = request - requests;
+        }
+
+        // Lines still buffered that could go out now mean no blocking in the
+        // next poll (ones waiting for room get woken by the queue's fd)
+        backlog = 0;
+        for (int c = 0; c < DAEMON_MAX_CLIENTS; c++) {
+            DaemonClient *client = &clients[c];
+            if (client->fd < 0) continue;
+            if (!flush_client(client, &stats, open_clients, in_flight, team)) {
+                close_client(client, &open_clients);
+                continue;
+            }
+            if (client->eof && client->input_length && !memchr(client->input, '\n', client->input_length)) {
+                if (client->input_length < CLIENT_INPUT) {
+                    client->input[client->input_length++] = '\n';  // last line without a newline
+                } else if (client_room(client)) {
+                    reject_overlong(client, &stats);  // no byte left for one
+                }
+            }
+            if (client->input_length == CLIENT_INPUT ||
+                (client->input_length && memchr(client->input, '\n', client->input_length))) {
+                backlog |= client_room(client) > 0 && free_request >= 0;
+            } else if (client->eof && client->flush_seq == client->next_seq && !client->output_length) {
+                close_client(client, &open_clients);
+            }
+        }
+    }
+
+    printf("# shutting down\n");
+    close(listen_fd);
+    unlink(path);
+    solve_queue_destroy(queue);
+    for (int c = 0; c < DAEMON_MAX_CLIENTS; c++) {
+        if (clients[c].fd >= 0) close_client(&clients[c], &open_clients);
+    }
+
+    static char text[8192];
+    format_stats(text, sizeof(text), &stats, 0, 0, team);
+    fputs(text, stdout);
+
+    free(fds);
+    free(batch);
+    free(requests);
+    free(clients);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,338 @@
+// Live metrics - counters that long batch jobs and the daemon update while
+// they run, so throughput can be watched (and regressions spotted) without
+// waiting for print_stats() at the end.
+//
+// Everything is process-wide and updated with atomic adds only: the solve
+// queue's workers record every puzzle they finish, the batch hybrid records
+// every search task. Per-thread slots sit on their own cache lines so busy
+// threads don't fight over them. A dump is Prometheus text exposition
+// format, written on request (the daemon's METRICS command) or every few
+// seconds to a file by a background thread (node_exporter's textfile
+// collector picks it up as is).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <omp.h>
+#include <pthread.h>
+
+#include "sudoku_advanced.h"
+
+// ========== Latency Histograms ==========
+
+static void atomic_max(unsigned long long *target, unsigned long long value) {
+    unsigned long long seen = __atomic_load_n(target, __ATOMIC_RELAXED);
+    while (value > seen &&
+           !__atomic_compare_exchange_n(target, &seen, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+void latency_record(LatencyHistogram *histogram, double seconds) {
+    unsigned long long ns = seconds > 0 ? (unsigned long long)(seconds * 1e9) : 0;
+    unsigned long long us = ns / 1000;
+    int bucket = us ? 64 - __builtin_clzll(us) : 0;
+    if (bucket >= LATENCY_BUCKETS) bucket = LATENCY_BUCKETS - 1;
+    #pragma omp atomic
+    histogram->counts[bucket]++;
+    #pragma omp atomic
+    histogram->total++;
+    #pragma omp atomic
+    histogram->sum_ns += ns;
+    atomic_max(&histogram->max_ns, ns);
+}
+
+// Upper bound (seconds) of the bucket holding the given fraction of samples
+double latency_percentile(const LatencyHistogram *histogram, double fraction) {
+    if (histogram->total == 0) return 0;
+    unsigned long long rank = (unsigned long long)(fraction * histogram->total);
+    unsigned long long seen = 0;
+    for (int b = 0; b < LATENCY_BUCKETS - 1; b++) {
+        seen += histogram->counts[b];
+        if (seen > rank) return (1ULL << b) * 1e-6;
+    }
+    return histogram->max_ns * 1e-9;
+}
+
+// ========== Counters ==========
+
+// SolverStats counters that get exported, by offset so the table is the only
+// place that lists them. A label puts it in the sudoku_technique_total family.
+typedef struct {
+    const char *name;
+    const char *technique;
+    size_t offset;
+} MetricCounter;
+
+#define STAT(field) offsetof(SolverStats, field)
+
+static const MetricCounter counters[] = {
+    { "sudoku_nodes_total",               NULL,               STAT(nodes_explored) },
+    { "sudoku_backtracks_total",          NULL,               STAT(backtrack_count) },
+    { "sudoku_restarts_total",            NULL,               STAT(restarts) },
+    { "sudoku_budget_splits_total",       NULL,               STAT(budget_splits) },
+    { "sudoku_tt_hits_total",             NULL,               STAT(tt_hits) },
+    { "sudoku_nogood_prunes_total",       NULL,               STAT(nogood_prunes) },
+    { "sudoku_technique_total",           "naked_single",     STAT(naked_singles_found) },
+    { "sudoku_technique_total",           "hidden_single",    STAT(hidden_singles_found) },
+    { "sudoku_technique_total",           "pointing",         STAT(pointing_pairs_found) },
+    { "sudoku_technique_total",           "box_line",         STAT(box_line_reductions) },
+    { "sudoku_technique_total",           "xwing",            STAT(xwing_eliminations) },
+    { "sudoku_technique_total",           "swordfish",        STAT(swordfish_eliminations) },
+    { "sudoku_technique_total",           "xy_wing",          STAT(xy_wing_eliminations) },
+    { "sudoku_technique_total",           "nogood",           STAT(nogood_eliminations) },
+};
+
+#define NUM_COUNTERS ((int)(sizeof(counters) / sizeof(counters[0])))
+
+// Subsets are arrays by size, exported as one series each
+#define SUBSET_SERIES (2 * (MAX_SUBSET_SIZE - 1))
+
+// One cache line per thread: the alignment pads the struct to 64 bytes and
+// starts the array on a line boundary wherever it sits in metrics
+typedef struct {
+    unsigned long long puzzles;
+    unsigned long long busy_ns;
+} __attribute__((aligned(64))) ThreadMetrics;
+
+static const char *result_labels[4] = { "solved", "unsolvable", "timeout", "invalid" };
+
+static struct {
+    double started;
+    unsigned long long results[4];
+    unsigned long long values[NUM_COUNTERS];
+    unsigned long long subsets[SUBSET_SERIES];  // naked 2..MAX, then hidden 2..MAX
+    ThreadMetrics threads[MAX_THREADS];
+    LatencyHistogram latency;  // submission to finish (queue), per puzzle
+} metrics;
+
+static unsigned long long stat_value(const SolverStats *stats, size_t offset) {
+    return stats ? *(const unsigned long long *)((const char *)stats + offset) : 0;
+}
+
+// Uptime and rates count from the first call
+void metrics_start(void) {
+    #pragma omp critical (metrics_start)
+    {
+        if (metrics.started == 0) metrics.started = omp_get_wtime();
+    }
+}
+
+// Adds the work between two stats of one thread (before NULL = all of after)
+void metrics_record_work(const SolverStats *after, const SolverStats *before, int thread, double busy) {
+    for (int c = 0; c < NUM_COUNTERS; c++) {
+        unsigned long long delta = stat_value(after, counters[c].offset) - stat_value(before, counters[c].offset);
+        if (delta) {
+            #pragma omp atomic
+            metrics.values[c] += delta;
+        }
+    }
+    for (int k = 2; k <= MAX_SUBSET_SIZE; k++) {
+        unsigned long long naked = after->naked_subsets[k] - (before ? before->naked_subsets[k] : 0);
+        unsigned long long hidden = after->hidden_subsets[k] - (before ? before->hidden_subsets[k] : 0);
+        if (naked) {
+            #pragma omp atomic
+            metrics.subsets[k - 2] += naked;
+        }
+        if (hidden) {
+            #pragma omp atomic
+            metrics.subsets[MAX_SUBSET_SIZE - 1 + k - 2] += hidden;
+        }
+    }
+    if (thread >= 0 && thread < MAX_THREADS) {
+        #pragma omp atomic
+        metrics.threads[thread].busy_ns += (unsigned long long)(busy * 1e9);
+    }
+}
+
+// One finished puzzle; latency < 0 = not measured (the batch hybrid)
+void metrics_record_puzzle(int result, double latency) {
+    int r = result == 1 ? 0 : result == SOLVE_TIMED_OUT ? 2 : result == RESULT_INVALID ? 3 : 1;
+    int thread = omp_get_thread_num();
+    #pragma omp atomic
+    metrics.results[r]++;
+    if (thread < MAX_THREADS) {
+        #pragma omp atomic
+        metrics.threads[thread].puzzles++;
+    }
+    if (latency >= 0) latency_record(&metrics.latency, latency);
+}
+
+// ========== Prometheus Export ==========
+
+static unsigned long long read_counter(unsigned long long *value) {
+    unsigned long long v;
+    #pragma omp atomic read
+    v = *value;
+    return v;
+}
+
+// Appends with snprintf, keeping length in bounds
+#define EMIT(...) do { \
+        if (length < room) length += snprintf(out + length, room - length, __VA_ARGS__); \
+    } while (0)
+
+// The whole dump as text. previous (may be NULL) is the caller's last
+// snapshot: the per-second gauges cover the time since then (since start
+// without one), and it's updated to now.
+int metrics_format_prometheus(char *out, int room, MetricsSnapshot *previous) {
+    int length = 0;
+    double now = omp_get_wtime();
+    double started = metrics.started ? metrics.started : now;
+    MetricsSnapshot current = { now, 0, 0, {0} };
+    if (previous && previous->time == 0) previous->time = started;
+
+    EMIT("# HELP sudoku_uptime_seconds Time since metrics started.\n# TYPE sudoku_uptime_seconds gauge\n");
+    EMIT("sudoku_uptime_seconds %.3f\n", now - started);
+
+    EMIT("# HELP sudoku_puzzles_total Puzzles finished, by result.\n# TYPE sudoku_puzzles_total counter\n");
+    for (int r = 0; r < 4; r++) {
+        unsigned long long v = read_counter(&metrics.results[r]);
+        current.puzzles += v;
+        EMIT("sudoku_puzzles_total{result=\"%s\"} %llu\n", result_labels[r], v);
+    }
+
+    const char *family = NULL;
+    for (int c = 0; c < NUM_COUNTERS; c++) {
+        unsigned long long v = read_counter(&metrics.values[c]);
+        if (!family || strcmp(family, counters[c].name) != 0) {
+            family = counters[c].name;
+            EMIT("# TYPE %s counter\n", family);
+        }
+        if (counters[c].offset == STAT(nodes_explored)) current.nodes = v;
+        if (counters[c].technique) EMIT("%s{technique=\"%s\"} %llu\n", family, counters[c].technique, v);
+        else EMIT("%s %llu\n", family, v);
+    }
+    for (int s = 0; s < SUBSET_SERIES; s++) {
+        const char *kind = s < MAX_SUBSET_SIZE - 1 ? "naked" : "hidden";
+        int size = s % (MAX_SUBSET_SIZE - 1) + 2;
+        EMIT("sudoku_technique_total{technique=\"%s_subset_%d\"} %llu\n", kind, size,
+             read_counter(&metrics.subsets[s]));
+    }
+
+    double interval = previous ? now - previous->time : now - started;
+    EMIT("# HELP sudoku_puzzles_per_second Puzzles finished per second since the previous dump.\n");
+    EMIT("# TYPE sudoku_puzzles_per_second gauge\n");
+    EMIT("sudoku_puzzles_per_second %.1f\n",
+         interval > 0 ? (current.puzzles - (previous ? previous->puzzles : 0)) / interval : 0.0);
+    EMIT("# HELP sudoku_nodes_per_second Search nodes per second since the previous dump.\n");
+    EMIT("# TYPE sudoku_nodes_per_second gauge\n");
+    EMIT("sudoku_nodes_per_second %.1f\n",
+         interval > 0 ? (current.nodes - (previous ? previous->nodes : 0)) / interval : 0.0);
+
+    // Threads that never did anything are left out
+    EMIT("# HELP sudoku_thread_busy_seconds_total Time each team thread spent solving.\n");
+    EMIT("# TYPE sudoku_thread_busy_seconds_total counter\n");
+    for (int t = 0; t < MAX_THREADS; t++) {
+        current.busy_ns[t] = read_counter(&metrics.threads[t].busy_ns);
+        if (current.busy_ns[t]) EMIT("sudoku_thread_busy_seconds_total{thread=\"%d\"} %.6f\n", t, current.busy_ns[t] * 1e-9);
+    }
+    EMIT("# TYPE sudoku_thread_puzzles_total counter\n");
+    for (int t = 0; t < MAX_THREADS; t++) {
+        unsigned long long v = read_counter(&metrics.threads[t].puzzles);
+        if (v) EMIT("sudoku_thread_puzzles_total{thread=\"%d\"} %llu\n", t, v);
+    }
+    EMIT("# HELP sudoku_thread_utilization Busy fraction of each team thread since the previous dump.\n");
+    EMIT("# TYPE sudoku_thread_utilization gauge\n");
+    for (int t = 0; t < MAX_THREADS; t++) {
+        if (!current.busy_ns[t]) continue;
+        // Busy time is added when a solve ends, so one that spans the last
+        // dump lands in this interval in full - capped rather than over 1
+        double busy = (current.busy_ns[t] - (previous ? previous->busy_ns[t] : 0)) * 1e-9;
+        double utilization = interval > 0 ? busy / interval : 0.0;
+        EMIT("sudoku_thread_utilization{thread=\"%d\"} %.4f\n", t, utilization < 1 ? utilization : 1.0);
+    }
+
+    // Cumulative buckets, upper bounds in seconds
+    LatencyHistogram *h = &metrics.latency;
+    unsigned long long cumulative = 0;
+    EMIT("# HELP sudoku_latency_seconds Submission to result, per puzzle.\n");
+    EMIT("# TYPE sudoku_latency_seconds histogram\n");
+    for (int b = 0; b < LATENCY_BUCKETS - 1; b++) {
+        cumulative += read_counter(&h->counts[b]);
+        EMIT("sudoku_latency_seconds_bucket{le=\"%g\"} %llu\n", (1ULL << b) * 1e-6, cumulative);
+    }
+    cumulative += read_counter(&h->counts[LATENCY_BUCKETS - 1]);
+    EMIT("sudoku_latency_seconds_bucket{le=\"+Inf\"} %llu\n", cumulative);
+    EMIT("sudoku_latency_seconds_sum %.9f\n", read_counter(&h->sum_ns) * 1e-9);
+    EMIT("sudoku_latency_seconds_count %llu\n", cumulative);
+
+    if (previous) *previous = current;
+    return length < room ? length : room - 1;
+}
+
+// ========== Periodic Dump ==========
+
+static struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int running, stop;
+    const char *path;
+    double interval;
+    MetricsSnapshot previous;
+} dumper = { .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER };
+
+// Written next to the target and renamed over it, so a reader never sees
+// half a dump
+static void write_dump(void) {
+    static char text[METRICS_TEXT_SIZE];
+    char temp[1024];
+    int length = metrics_format_prometheus(text, sizeof(text), &dumper.previous);
+    snprintf(temp, sizeof(temp), "%s.tmp", dumper.path);
+    FILE *file = fopen(temp, "w");
+    if (!file) {
+        perror(temp);
+        return;
+    }
+    fwrite(text, 1, length, file);
+    fclose(file);
+#ifdef _WIN32
+    remove(dumper.path);
+#endif
+    if (rename(temp, dumper.path) != 0) perror(dumper.path);
+}
+
+static void *dump_loop(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&dumper.lock);
+    for (;;) {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        long long ns = until.tv_nsec + (long long)(dumper.interval * 1e9);
+        until.tv_sec += ns / 1000000000;
+        until.tv_nsec = ns % 1000000000;
+        while (!dumper.stop && pthread_cond_timedwait(&dumper.wake, &dumper.lock, &until) == 0) {
+        }
+        write_dump();
+        if (dumper.stop) break;
+    }
+    pthread_mutex_unlock(&dumper.lock);
+    return NULL;
+}
+
+// Rewrites path every interval seconds until metrics_stop_dumper(), which
+// writes it one last time. Returns 0 if the thread couldn't be started.
+int metrics_start_dumper(const char *path, double interval) {
+    metrics_start();
+    if (dumper.running) return 1;
+    dumper.path = path;
+    dumper.interval = interval > 0 ? interval : 10;
+    dumper.stop = 0;
+    memset(&dumper.previous, 0, sizeof(dumper.previous));
+    dumper.previous.time = omp_get_wtime();
+    if (pthread_create(&dumper.thread, NULL, dump_loop, NULL) != 0) return 0;
+    dumper.running = 1;
+    return 1;
+}
+
+void metrics_stop_dumper(void) {
+    if (!dumper.running) return;
+    pthread_mutex_lock(&dumper.lock);
+    dumper.stop = 1;
+    pthread_cond_signal(&dumper.wake);
+    pthread_mutex_unlock(&dumper.lock);
+    pthread_join(dumper.thread, NULL);
+    dumper.running = 0;
+}
@@ -0,0 +1,792 @@
+// Generated by gen_tables.c - do not edit, run `make tables` instead
+
+#ifndef SUDOKU_TABLES_H
+#define SUDOKU_TABLES_H
+
+#define NUM_CELLS 81
+#define NUM_UNITS 27
+#define NUM_PEERS 20
+
+#define ROW_UNIT(r) (r)
+#define COL_UNIT(c) (9 + (c))
+#define BOX_UNIT(b) (18 + (b))
+
+static const unsigned char cell_row[NUM_CELLS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 8,
+};
+
+static const unsigned char cell_col[NUM_CELLS] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8,
+};
+
+static const unsigned char cell_box[NUM_CELLS] = {
+    0, 0, 0, 1, 1, 1, 2, 2, 2,
+    0, 0, 0, 1, 1, 1, 2, 2, 2,
+    0, 0, 0, 1, 1, 1, 2, 2, 2,
+    3, 3, 3, 4, 4, 4, 5, 5, 5,
+    3, 3, 3, 4, 4, 4, 5, 5, 5,
+    3, 3, 3, 4, 4, 4, 5, 5, 5,
+    6, 6, 6, 7, 7, 7, 8, 8, 8,
+    6, 6, 6, 7, 7, 7, 8, 8, 8,
+    6, 6, 6, 7, 7, 7, 8, 8, 8,
+};
+
+// Cells of each unit, in row-major order
+static const unsigned char unit_cells[NUM_UNITS][9] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8 },
+    {  9, 10, 11, 12, 13, 14, 15, 16, 17 },
+    { 18, 19, 20, 21, 22, 23, 24, 25, 26 },
+    { 27, 28, 29, 30, 31, 32, 33, 34, 35 },
+    { 36, 37, 38, 39, 40, 41, 42, 43, 44 },
+    { 45, 46, 47, 48, 49, 50, 51, 52, 53 },
+    { 54, 55, 56, 57, 58, 59, 60, 61, 62 },
+    { 63, 64, 65, 66, 67, 68, 69, 70, 71 },
+    { 72, 73, 74, 75, 76, 77, 78, 79, 80 },
+    {  0,  9, 18, 27, 36, 45, 54, 63, 72 },
+    {  1, 10, 19, 28, 37, 46, 55, 64, 73 },
+    {  2, 11, 20, 29, 38, 47, 56, 65, 74 },
+    {  3, 12, 21, 30, 39, 48, 57, 66, 75 },
+    {  4, 13, 22, 31, 40, 49, 58, 67, 76 },
+    {  5, 14, 23, 32, 41, 50, 59, 68, 77 },
+    {  6, 15, 24, 33, 42, 51, 60, 69, 78 },
+    {  7, 16, 25, 34, 43, 52, 61, 70, 79 },
+    {  8, 17, 26, 35, 44, 53, 62, 71, 80 },
+    {  0,  1,  2,  9, 10, 11, 18, 19, 20 },
+    {  3,  4,  5, 12, 13, 14, 21, 22, 23 },
+    {  6,  7,  8, 15, 16, 17, 24, 25, 26 },
+    { 27, 28, 29, 36, 37, 38, 45, 46, 47 },
+    { 30, 31, 32, 39, 40, 41, 48, 49, 50 },
+    { 33, 34, 35, 42, 43, 44, 51, 52, 53 },
+    { 54, 55, 56, 63, 64, 65, 72, 73, 74 },
+    { 57, 58, 59, 66, 67, 68, 75, 76, 77 },
+    { 60, 61, 62, 69, 70, 71, 78, 79, 80 },
+};
+
+// Row, column and box unit of each cell
+static const unsigned char cell_units[NUM_CELLS][3] = {
+    {  0,  9, 18 },
+    {  0, 10, 18 },
+    {  0, 11, 18 },
+    {  0, 12, 19 },
+    {  0, 13, 19 },
+    {  0, 14, 19 },
+    {  0, 15, 20 },
+    {  0, 16, 20 },
+    {  0, 17, 20 },
+    {  1,  9, 18 },
+    {  1, 10, 18 },
+    {  1, 11, 18 },
+    {  1, 12, 19 },
+    {  1, 13, 19 },
+    {  1, 14, 19 },
+    {  1, 15, 20 },
+    {  1, 16, 20 },
+    {  1, 17, 20 },
+    {  2,  9, 18 },
+    {  2, 10, 18 },
+    {  2, 11, 18 },
+    {  2, 12, 19 },
+    {  2, 13, 19 },
+    {  2, 14, 19 },
+    {  2, 15, 20 },
+    {  2, 16, 20 },
+    {  2, 17, 20 },
+    {  3,  9, 21 },
+    {  3, 10, 21 },
+    {  3, 11, 21 },
+    {  3, 12, 22 },
+    {  3, 13, 22 },
+    {  3, 14, 22 },
+    {  3, 15, 23 },
+    {  3, 16, 23 },
+    {  3, 17, 23 },
+    {  4,  9, 21 },
+    {  4, 10, 21 },
+    {  4, 11, 21 },
+    {  4, 12, 22 },
+    {  4, 13, 22 },
+    {  4, 14, 22 },
+    {  4, 15, 23 },
+    {  4, 16, 23 },
+    {  4, 17, 23 },
+    {  5,  9, 21 },
+    {  5, 10, 21 },
+    {  5, 11, 21 },
+    {  5, 12, 22 },
+    {  5, 13, 22 },
+    {  5, 14, 22 },
+    {  5, 15, 23 },
+    {  5, 16, 23 },
+    {  5, 17, 23 },
+    {  6,  9, 24 },
+    {  6, 10, 24 },
+    {  6, 11, 24 },
+    {  6, 12, 25 },
+    {  6, 13, 25 },
+    {  6, 14, 25 },
+    {  6, 15, 26 },
+    {  6, 16, 26 },
+    {  6, 17, 26 },
+    {  7,  9, 24 },
+    {  7, 10, 24 },
+    {  7, 11, 24 },
+    {  7, 12, 25 },
+    {  7, 13, 25 },
+    {  7, 14, 25 },
+    {  7, 15, 26 },
+    {  7, 16, 26 },
+    {  7, 17, 26 },
+    {  8,  9, 24 },
+    {  8, 10, 24 },
+    {  8, 11, 24 },
+    {  8, 12, 25 },
+    {  8, 13, 25 },
+    {  8, 14, 25 },
+    {  8, 15, 26 },
+    {  8, 16, 26 },
+    {  8, 17, 26 },
+};
+
+// The 20 other cells sharing a row, column or box with each cell
+static const unsigned char cell_peers[NUM_CELLS][NUM_PEERS] = {
+    {  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 18, 19, 20, 27, 36, 45, 54, 63, 72 },
+    {  0,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 18, 19, 20, 28, 37, 46, 55, 64, 73 },
+    {  0,  1,  3,  4,  5,  6,  7,  8,  9, 10, 11, 18, 19, 20, 29, 38, 47, 56, 65, 74 },
+    {  0,  1,  2,  4,  5,  6,  7,  8, 12, 13, 14, 21, 22, 23, 30, 39, 48, 57, 66, 75 },
+    {  0,  1,  2,  3,  5,  6,  7,  8, 12, 13, 14, 21, 22, 23, 31, 40, 49, 58, 67, 76 },
+    {  0,  1,  2,  3,  4,  6,  7,  8, 12, 13, 14, 21, 22, 23, 32, 41, 50, 59, 68, 77 },
+    {  0,  1,  2,  3,  4,  5,  7,  8, 15, 16, 17, 24, 25, 26, 33, 42, 51, 60, 69, 78 },
+    {  0,  1,  2,  3,  4,  5,  6,  8, 15, 16, 17, 24, 25, 26, 34, 43, 52, 61, 70, 79 },
+    {  0,  1,  2,  3,  4,  5,  6,  7, 15, 16, 17, 24, 25, 26, 35, 44, 53, 62, 71, 80 },
+    {  0,  1,  2, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 27, 36, 45, 54, 63, 72 },
+    {  0,  1,  2,  9, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 28, 37, 46, 55, 64, 73 },
+    {  0,  1,  2,  9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 29, 38, 47, 56, 65, 74 },
+    {  3,  4,  5,  9, 10, 11, 13, 14, 15, 16, 17, 21, 22, 23, 30, 39, 48, 57, 66, 75 },
+    {  3,  4,  5,  9, 10, 11, 12, 14, 15, 16, 17, 21, 22, 23, 31, 40, 49, 58, 67, 76 },
+    {  3,  4,  5,  9, 10, 11, 12, 13, 15, 16, 17, 21, 22, 23, 32, 41, 50, 59, 68, 77 },
+    {  6,  7,  8,  9, 10, 11, 12, 13, 14, 16, 17, 24, 25, 26, 33, 42, 51, 60, 69, 78 },
+    {  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 17, 24, 25, 26, 34, 43, 52, 61, 70, 79 },
+    {  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 24, 25, 26, 35, 44, 53, 62, 71, 80 },
+    {  0,  1,  2,  9, 10, 11, 19, 20, 21, 22, 23, 24, 25, 26, 27, 36, 45, 54, 63, 72 },
+    {  0,  1,  2,  9, 10, 11, 18, 20, 21, 22, 23, 24, 25, 26, 28, 37, 46, 55, 64, 73 },
+    {  0,  1,  2,  9, 10, 11, 18, 19, 21, 22, 23, 24, 25, 26, 29, 38, 47, 56, 65, 74 },
+    {  3,  4,  5, 12, 13, 14, 18, 19, 20, 22, 23, 24, 25, 26, 30, 39, 48, 57, 66, 75 },
+    {  3,  4,  5, 12, 13, 14, 18, 19, 20, 21, 23, 24, 25, 26, 31, 40, 49, 58, 67, 76 },
+    {  3,  4,  5, 12, 13, 14, 18, 19, 20, 21, 22, 24, 25, 26, 32, 41, 50, 59, 68, 77 },
+    {  6,  7,  8, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 33, 42, 51, 60, 69, 78 },
+    {  6,  7,  8, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 26, 34, 43, 52, 61, 70, 79 },
+    {  6,  7,  8, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 35, 44, 53, 62, 71, 80 },
+    {  0,  9, 18, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 45, 46, 47, 54, 63, 72 },
+    {  1, 10, 19, 27, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 45, 46, 47, 55, 64, 73 },
+    {  2, 11, 20, 27, 28, 30, 31, 32, 33, 34, 35, 36, 37, 38, 45, 46, 47, 56, 65, 74 },
+    {  3, 12, 21, 27, 28, 29, 31, 32, 33, 34, 35, 39, 40, 41, 48, 49, 50, 57, 66, 75 },
+    {  4, 13, 22, 27, 28, 29, 30, 32, 33, 34, 35, 39, 40, 41, 48, 49, 50, 58, 67, 76 },
+    {  5, 14, 23, 27, 28, 29, 30, 31, 33, 34, 35, 39, 40, 41, 48, 49, 50, 59, 68, 77 },
+    {  6, 15, 24, 27, 28, 29, 30, 31, 32, 34, 35, 42, 43, 44, 51, 52, 53, 60, 69, 78 },
+    {  7, 16, 25, 27, 28, 29, 30, 31, 32, 33, 35, 42, 43, 44, 51, 52, 53, 61, 70, 79 },
+    {  8, 17, 26, 27, 28, 29, 30, 31, 32, 33, 34, 42, 43, 44, 51, 52, 53, 62, 71, 80 },
+    {  0,  9, 18, 27, 28, 29, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 54, 63, 72 },
+    {  1, 10, 19, 27, 28, 29, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 55, 64, 73 },
+    {  2, 11, 20, 27, 28, 29, 36, 37, 39, 40, 41, 42, 43, 44, 45, 46, 47, 56, 65, 74 },
+    {  3, 12, 21, 30, 31, 32, 36, 37, 38, 40, 41, 42, 43, 44, 48, 49, 50, 57, 66, 75 },
+    {  4, 13, 22, 30, 31, 32, 36, 37, 38, 39, 41, 42, 43, 44, 48, 49, 50, 58, 67, 76 },
+    {  5, 14, 23, 30, 31, 32, 36, 37, 38, 39, 40, 42, 43, 44, 48, 49, 50, 59, 68, 77 },
+    {  6, 15, 24, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 51, 52, 53, 60, 69, 78 },
+    {  7, 16, 25, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 44, 51, 52, 53, 61, 70, 79 },
+    {  8, 17, 26, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 51, 52, 53, 62, 71, 80 },
+    {  0,  9, 18, 27, 28, 29, 36, 37, 38, 46, 47, 48, 49, 50, 51, 52, 53, 54, 63, 72 },
+    {  1, 10, 19, 27, 28, 29, 36, 37, 38, 45, 47, 48, 49, 50, 51, 52, 53, 55, 64, 73 },
+    {  2, 11, 20, 27, 28, 29, 36, 37, 38, 45, 46, 48, 49, 50, 51, 52, 53, 56, 65, 74 },
+    {  3, 12, 21, 30, 31, 32, 39, 40, 41, 45, 46, 47, 49, 50, 51, 52, 53, 57, 66, 75 },
+    {  4, 13, 22, 30, 31, 32, 39, 40, 41, 45, 46, 47, 48, 50, 51, 52, 53, 58, 67, 76 },
+    {  5, 14, 23, 30, 31, 32, 39, 40, 41, 45, 46, 47, 48, 49, 51, 52, 53, 59, 68, 77 },
+    {  6, 15, 24, 33, 34, 35, 42, 43, 44, 45, 46, 47, 48, 49, 50, 52, 53, 60, 69, 78 },
+    {  7, 16, 25, 33, 34, 35, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 53, 61, 70, 79 },
+    {  8, 17, 26, 33, 34, 35, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 62, 71, 80 },
+    {  0,  9, 18, 27, 36, 45, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 72, 73, 74 },
+    {  1, 10, 19, 28, 37, 46, 54, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 72, 73, 74 },
+    {  2, 11, 20, 29, 38, 47, 54, 55, 57, 58, 59, 60, 61, 62, 63, 64, 65, 72, 73, 74 },
+    {  3, 12, 21, 30, 39, 48, 54, 55, 56, 58, 59, 60, 61, 62, 66, 67, 68, 75, 76, 77 },
+    {  4, 13, 22, 31, 40, 49, 54, 55, 56, 57, 59, 60, 61, 62, 66, 67, 68, 75, 76, 77 },
+    {  5, 14, 23, 32, 41, 50, 54, 55, 56, 57, 58, 60, 61, 62, 66, 67, 68, 75, 76, 77 },
+    {  6, 15, 24, 33, 42, 51, 54, 55, 56, 57, 58, 59, 61, 62, 69, 70, 71, 78, 79, 80 },
+    {  7, 16, 25, 34, 43, 52, 54, 55, 56, 57, 58, 59, 60, 62, 69, 70, 71, 78, 79, 80 },
+    {  8, 17, 26, 35, 44, 53, 54, 55, 56, 57, 58, 59, 60, 61, 69, 70, 71, 78, 79, 80 },
+    {  0,  9, 18, 27, 36, 45, 54, 55, 56, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 },
+    {  1, 10, 19, 28, 37, 46, 54, 55, 56, 63, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 },
+    {  2, 11, 20, 29, 38, 47, 54, 55, 56, 63, 64, 66, 67, 68, 69, 70, 71, 72, 73, 74 },
+    {  3, 12, 21, 30, 39, 48, 57, 58, 59, 63, 64, 65, 67, 68, 69, 70, 71, 75, 76, 77 },
+    {  4, 13, 22, 31, 40, 49, 57, 58, 59, 63, 64, 65, 66, 68, 69, 70, 71, 75, 76, 77 },
+    {  5, 14, 23, 32, 41, 50, 57, 58, 59, 63, 64, 65, 66, 67, 69, 70, 71, 75, 76, 77 },
+    {  6, 15, 24, 33, 42, 51, 60, 61, 62, 63, 64, 65, 66, 67, 68, 70, 71, 78, 79, 80 },
+    {  7, 16, 25, 34, 43, 52, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 71, 78, 79, 80 },
+    {  8, 17, 26, 35, 44, 53, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 78, 79, 80 },
+    {  0,  9, 18, 27, 36, 45, 54, 55, 56, 63, 64, 65, 73, 74, 75, 76, 77, 78, 79, 80 },
+    {  1, 10, 19, 28, 37, 46, 54, 55, 56, 63, 64, 65, 72, 74, 75, 76, 77, 78, 79, 80 },
+    {  2, 11, 20, 29, 38, 47, 54, 55, 56, 63, 64, 65, 72, 73, 75, 76, 77, 78, 79, 80 },
+    {  3, 12, 21, 30, 39, 48, 57, 58, 59, 66, 67, 68, 72, 73, 74, 76, 77, 78, 79, 80 },
+    {  4, 13, 22, 31, 40, 49, 57, 58, 59, 66, 67, 68, 72, 73, 74, 75, 77, 78, 79, 80 },
+    {  5, 14, 23, 32, 41, 50, 57, 58, 59, 66, 67, 68, 72, 73, 74, 75, 76, 78, 79, 80 },
+    {  6, 15, 24, 33, 42, 51, 60, 61, 62, 69, 70, 71, 72, 73, 74, 75, 76, 77, 79, 80 },
+    {  7, 16, 25, 34, 43, 52, 60, 61, 62, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 80 },
+    {  8, 17, 26, 35, 44, 53, 60, 61, 62, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79 },
+};
+
+#define BAND_CELLS 27
+#define BAND_MASK 0x7FFFFFF
+
+// Peers of each cell as a bit mask per band (the cell itself not included)
+static const unsigned int band_peers[NUM_CELLS][3] = {
+    { 0x01C0FFE, 0x0040201, 0x0040201 },
+    { 0x01C0FFD, 0x0080402, 0x0080402 },
+    { 0x01C0FFB, 0x0100804, 0x0100804 },
+    { 0x0E071F7, 0x0201008, 0x0201008 },
+    { 0x0E071EF, 0x0402010, 0x0402010 },
+    { 0x0E071DF, 0x0804020, 0x0804020 },
+    { 0x70381BF, 0x1008040, 0x1008040 },
+    { 0x703817F, 0x2010080, 0x2010080 },
+    { 0x70380FF, 0x4020100, 0x4020100 },
+    { 0x01FFC07, 0x0040201, 0x0040201 },
+    { 0x01FFA07, 0x0080402, 0x0080402 },
+    { 0x01FF607, 0x0100804, 0x0100804 },
+    { 0x0E3EE38, 0x0201008, 0x0201008 },
+    { 0x0E3DE38, 0x0402010, 0x0402010 },
+    { 0x0E3BE38, 0x0804020, 0x0804020 },
+    { 0x7037FC0, 0x1008040, 0x1008040 },
+    { 0x702FFC0, 0x2010080, 0x2010080 },
+    { 0x701FFC0, 0x4020100, 0x4020100 },
+    { 0x7F80E07, 0x0040201, 0x0040201 },
+    { 0x7F40E07, 0x0080402, 0x0080402 },
+    { 0x7EC0E07, 0x0100804, 0x0100804 },
+    { 0x7DC7038, 0x0201008, 0x0201008 },
+    { 0x7BC7038, 0x0402010, 0x0402010 },
+    { 0x77C7038, 0x0804020, 0x0804020 },
+    { 0x6FF81C0, 0x1008040, 0x1008040 },
+    { 0x5FF81C0, 0x2010080, 0x2010080 },
+    { 0x3FF81C0, 0x4020100, 0x4020100 },
+    { 0x0040201, 0x01C0FFE, 0x0040201 },
+    { 0x0080402, 0x01C0FFD, 0x0080402 },
+    { 0x0100804, 0x01C0FFB, 0x0100804 },
+    { 0x0201008, 0x0E071F7, 0x0201008 },
+    { 0x0402010, 0x0E071EF, 0x0402010 },
+    { 0x0804020, 0x0E071DF, 0x0804020 },
+    { 0x1008040, 0x70381BF, 0x1008040 },
+    { 0x2010080, 0x703817F, 0x2010080 },
+    { 0x4020100, 0x70380FF, 0x4020100 },
+    { 0x0040201, 0x01FFC07, 0x0040201 },
+    { 0x0080402, 0x01FFA07, 0x0080402 },
+    { 0x0100804, 0x01FF607, 0x0100804 },
+    { 0x0201008, 0x0E3EE38, 0x0201008 },
+    { 0x0402010, 0x0E3DE38, 0x0402010 },
+    { 0x0804020, 0x0E3BE38, 0x0804020 },
+    { 0x1008040, 0x7037FC0, 0x1008040 },
+    { 0x2010080, 0x702FFC0, 0x2010080 },
+    { 0x4020100, 0x701FFC0, 0x4020100 },
+    { 0x0040201, 0x7F80E07, 0x0040201 },
+    { 0x0080402, 0x7F40E07, 0x0080402 },
+    { 0x0100804, 0x7EC0E07, 0x0100804 },
+    { 0x0201008, 0x7DC7038, 0x0201008 },
+    { 0x0402010, 0x7BC7038, 0x0402010 },
+    { 0x0804020, 0x77C7038, 0x0804020 },
+    { 0x1008040, 0x6FF81C0, 0x1008040 },
+    { 0x2010080, 0x5FF81C0, 0x2010080 },
+    { 0x4020100, 0x3FF81C0, 0x4020100 },
+    { 0x0040201, 0x0040201, 0x01C0FFE },
+    { 0x0080402, 0x0080402, 0x01C0FFD },
+    { 0x0100804, 0x0100804, 0x01C0FFB },
+    { 0x0201008, 0x0201008, 0x0E071F7 },
+    { 0x0402010, 0x0402010, 0x0E071EF },
+    { 0x0804020, 0x0804020, 0x0E071DF },
+    { 0x1008040, 0x1008040, 0x70381BF },
+    { 0x2010080, 0x2010080, 0x703817F },
+    { 0x4020100, 0x4020100, 0x70380FF },
+    { 0x0040201, 0x0040201, 0x01FFC07 },
+    { 0x0080402, 0x0080402, 0x01FFA07 },
+    { 0x0100804, 0x0100804, 0x01FF607 },
+    { 0x0201008, 0x0201008, 0x0E3EE38 },
+    { 0x0402010, 0x0402010, 0x0E3DE38 },
+    { 0x0804020, 0x0804020, 0x0E3BE38 },
+    { 0x1008040, 0x1008040, 0x7037FC0 },
+    { 0x2010080, 0x2010080, 0x702FFC0 },
+    { 0x4020100, 0x4020100, 0x701FFC0 },
+    { 0x0040201, 0x0040201, 0x7F80E07 },
+    { 0x0080402, 0x0080402, 0x7F40E07 },
+    { 0x0100804, 0x0100804, 0x7EC0E07 },
+    { 0x0201008, 0x0201008, 0x7DC7038 },
+    { 0x0402010, 0x0402010, 0x7BC7038 },
+    { 0x0804020, 0x0804020, 0x77C7038 },
+    { 0x1008040, 0x1008040, 0x6FF81C0 },
+    { 0x2010080, 0x2010080, 0x5FF81C0 },
+    { 0x4020100, 0x4020100, 0x3FF81C0 },
+};
+
+// 9 bits of a row -> which of its 3 boxes are non-empty
+static const unsigned char row_boxes[512] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3,
+    2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7,
+};
+
+// Minirow mask -> minirows some row/box permutation can still use, 0 = dead end.
+// The same table works for columns x bands inside a stack.
+static const unsigned short band_locked[512] = {
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x054, 0x054, 0x054, 0x054, 0x000, 0x000, 0x000, 0x000, 0x054, 0x054, 0x054, 0x054,
+    0x000, 0x000, 0x062, 0x062, 0x000, 0x000, 0x062, 0x062, 0x000, 0x000, 0x062, 0x062, 0x000, 0x000, 0x062, 0x062,
+    0x000, 0x000, 0x062, 0x062, 0x054, 0x054, 0x076, 0x076, 0x000, 0x000, 0x062, 0x062, 0x054, 0x054, 0x076, 0x076,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x08C, 0x08C, 0x08C, 0x08C,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x08C, 0x08C, 0x08C, 0x08C,
+    0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x08C, 0x0AD, 0x08C, 0x0AD,
+    0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x08C, 0x0AD, 0x08C, 0x0AD,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x08C, 0x08C, 0x08C, 0x08C,
+    0x000, 0x000, 0x000, 0x000, 0x054, 0x054, 0x054, 0x054, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x0DC, 0x0DC,
+    0x000, 0x0A1, 0x062, 0x0E3, 0x000, 0x0A1, 0x062, 0x0E3, 0x000, 0x0A1, 0x062, 0x0E3, 0x08C, 0x0AD, 0x0EE, 0x0EF,
+    0x000, 0x0A1, 0x062, 0x0E3, 0x054, 0x0F5, 0x076, 0x0F7, 0x000, 0x0A1, 0x062, 0x0E3, 0x0DC, 0x0FD, 0x0FE, 0x0FF,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x10A, 0x10A, 0x000, 0x000, 0x10A, 0x10A,
+    0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x10A, 0x11B, 0x000, 0x111, 0x10A, 0x11B,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x10A, 0x10A, 0x000, 0x000, 0x10A, 0x10A,
+    0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x10A, 0x11B, 0x000, 0x111, 0x10A, 0x11B,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x10A, 0x10A, 0x000, 0x000, 0x10A, 0x10A,
+    0x000, 0x111, 0x000, 0x111, 0x054, 0x155, 0x054, 0x155, 0x000, 0x111, 0x10A, 0x11B, 0x054, 0x155, 0x15E, 0x15F,
+    0x000, 0x000, 0x062, 0x062, 0x000, 0x000, 0x062, 0x062, 0x000, 0x000, 0x16A, 0x16A, 0x000, 0x000, 0x16A, 0x16A,
+    0x000, 0x111, 0x062, 0x173, 0x054, 0x155, 0x076, 0x177, 0x000, 0x111, 0x16A, 0x17B, 0x054, 0x155, 0x17E, 0x17F,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x10A, 0x10A, 0x08C, 0x08C, 0x18E, 0x18E,
+    0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x000, 0x111, 0x10A, 0x11B, 0x08C, 0x19D, 0x18E, 0x19F,
+    0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x000, 0x0A1, 0x10A, 0x1AB, 0x08C, 0x0AD, 0x18E, 0x1AF,
+    0x000, 0x1B1, 0x000, 0x1B1, 0x000, 0x1B1, 0x000, 0x1B1, 0x000, 0x1B1, 0x10A, 0x1BB, 0x08C, 0x1BD, 0x18E, 0x1BF,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x10A, 0x10A, 0x08C, 0x08C, 0x18E, 0x18E,
+    0x000, 0x111, 0x000, 0x111, 0x054, 0x155, 0x054, 0x155, 0x000, 0x111, 0x10A, 0x11B, 0x0DC, 0x1DD, 0x1DE, 0x1DF,
+    0x000, 0x0A1, 0x062, 0x0E3, 0x000, 0x0A1, 0x062, 0x0E3, 0x000, 0x0A1, 0x16A, 0x1EB, 0x08C, 0x0AD, 0x1EE, 0x1EF,
+    0x000, 0x1B1, 0x062, 0x1F3, 0x054, 0x1F5, 0x076, 0x1F7, 0x000, 0x1B1, 0x16A, 0x1FB, 0x0DC, 0x1FD, 0x1FE, 0x1FF,
+};
+
+// Minirow mask -> the band cells it covers
+static const unsigned int minirow_cells[512] = {
+    0x0000000, 0x0000007, 0x0000038, 0x000003F, 0x00001C0, 0x00001C7, 0x00001F8, 0x00001FF,
+    0x0000E00, 0x0000E07, 0x0000E38, 0x0000E3F, 0x0000FC0, 0x0000FC7, 0x0000FF8, 0x0000FFF,
+    0x0007000, 0x0007007, 0x0007038, 0x000703F, 0x00071C0, 0x00071C7, 0x00071F8, 0x00071FF,
+    0x0007E00, 0x0007E07, 0x0007E38, 0x0007E3F, 0x0007FC0, 0x0007FC7, 0x0007FF8, 0x0007FFF,
+    0x0038000, 0x0038007, 0x0038038, 0x003803F, 0x00381C0, 0x00381C7, 0x00381F8, 0x00381FF,
+    0x0038E00, 0x0038E07, 0x0038E38, 0x0038E3F, 0x0038FC0, 0x0038FC7, 0x0038FF8, 0x0038FFF,
+    0x003F000, 0x003F007, 0x003F038, 0x003F03F, 0x003F1C0, 0x003F1C7, 0x003F1F8, 0x003F1FF,
+    0x003FE00, 0x003FE07, 0x003FE38, 0x003FE3F, 0x003FFC0, 0x003FFC7, 0x003FFF8, 0x003FFFF,
+    0x01C0000, 0x01C0007, 0x01C0038, 0x01C003F, 0x01C01C0, 0x01C01C7, 0x01C01F8, 0x01C01FF,
+    0x01C0E00, 0x01C0E07, 0x01C0E38, 0x01C0E3F, 0x01C0FC0, 0x01C0FC7, 0x01C0FF8, 0x01C0FFF,
+    0x01C7000, 0x01C7007, 0x01C7038, 0x01C703F, 0x01C71C0, 0x01C71C7, 0x01C71F8, 0x01C71FF,
+    0x01C7E00, 0x01C7E07, 0x01C7E38, 0x01C7E3F, 0x01C7FC0, 0x01C7FC7, 0x01C7FF8, 0x01C7FFF,
+    0x01F8000, 0x01F8007, 0x01F8038, 0x01F803F, 0x01F81C0, 0x01F81C7, 0x01F81F8, 0x01F81FF,
+    0x01F8E00, 0x01F8E07, 0x01F8E38, 0x01F8E3F, 0x01F8FC0, 0x01F8FC7, 0x01F8FF8, 0x01F8FFF,
+    0x01FF000, 0x01FF007, 0x01FF038, 0x01FF03F, 0x01FF1C0, 0x01FF1C7, 0x01FF1F8, 0x01FF1FF,
+    0x01FFE00, 0x01FFE07, 0x01FFE38, 0x01FFE3F, 0x01FFFC0, 0x01FFFC7, 0x01FFFF8, 0x01FFFFF,
+    0x0E00000, 0x0E00007, 0x0E00038, 0x0E0003F, 0x0E001C0, 0x0E001C7, 0x0E001F8, 0x0E001FF,
+    0x0E00E00, 0x0E00E07, 0x0E00E38, 0x0E00E3F, 0x0E00FC0, 0x0E00FC7, 0x0E00FF8, 0x0E00FFF,
+    0x0E07000, 0x0E07007, 0x0E07038, 0x0E0703F, 0x0E071C0, 0x0E071C7, 0x0E071F8, 0x0E071FF,
+    0x0E07E00, 0x0E07E07, 0x0E07E38, 0x0E07E3F, 0x0E07FC0, 0x0E07FC7, 0x0E07FF8, 0x0E07FFF,
+    0x0E38000, 0x0E38007, 0x0E38038, 0x0E3803F, 0x0E381C0, 0x0E381C7, 0x0E381F8, 0x0E381FF,
+    0x0E38E00, 0x0E38E07, 0x0E38E38, 0x0E38E3F, 0x0E38FC0, 0x0E38FC7, 0x0E38FF8, 0x0E38FFF,
+    0x0E3F000, 0x0E3F007, 0x0E3F038, 0x0E3F03F, 0x0E3F1C0, 0x0E3F1C7, 0x0E3F1F8, 0x0E3F1FF,
+    0x0E3FE00, 0x0E3FE07, 0x0E3FE38, 0x0E3FE3F, 0x0E3FFC0, 0x0E3FFC7, 0x0E3FFF8, 0x0E3FFFF,
+    0x0FC0000, 0x0FC0007, 0x0FC0038, 0x0FC003F, 0x0FC01C0, 0x0FC01C7, 0x0FC01F8, 0x0FC01FF,
+    0x0FC0E00, 0x0FC0E07, 0x0FC0E38, 0x0FC0E3F, 0x0FC0FC0, 0x0FC0FC7, 0x0FC0FF8, 0x0FC0FFF,
+    0x0FC7000, 0x0FC7007, 0x0FC7038, 0x0FC703F, 0x0FC71C0, 0x0FC71C7, 0x0FC71F8, 0x0FC71FF,
+    0x0FC7E00, 0x0FC7E07, 0x0FC7E38, 0x0FC7E3F, 0x0FC7FC0, 0x0FC7FC7, 0x0FC7FF8, 0x0FC7FFF,
+    0x0FF8000, 0x0FF8007, 0x0FF8038, 0x0FF803F, 0x0FF81C0, 0x0FF81C7, 0x0FF81F8, 0x0FF81FF,
+    0x0FF8E00, 0x0FF8E07, 0x0FF8E38, 0x0FF8E3F, 0x0FF8FC0, 0x0FF8FC7, 0x0FF8FF8, 0x0FF8FFF,
+    0x0FFF000, 0x0FFF007, 0x0FFF038, 0x0FFF03F, 0x0FFF1C0, 0x0FFF1C7, 0x0FFF1F8, 0x0FFF1FF,
+    0x0FFFE00, 0x0FFFE07, 0x0FFFE38, 0x0FFFE3F, 0x0FFFFC0, 0x0FFFFC7, 0x0FFFFF8, 0x0FFFFFF,
+    0x7000000, 0x7000007, 0x7000038, 0x700003F, 0x70001C0, 0x70001C7, 0x70001F8, 0x70001FF,
+    0x7000E00, 0x7000E07, 0x7000E38, 0x7000E3F, 0x7000FC0, 0x7000FC7, 0x7000FF8, 0x7000FFF,
+    0x7007000, 0x7007007, 0x7007038, 0x700703F, 0x70071C0, 0x70071C7, 0x70071F8, 0x70071FF,
+    0x7007E00, 0x7007E07, 0x7007E38, 0x7007E3F, 0x7007FC0, 0x7007FC7, 0x7007FF8, 0x7007FFF,
+    0x7038000, 0x7038007, 0x7038038, 0x703803F, 0x70381C0, 0x70381C7, 0x70381F8, 0x70381FF,
+    0x7038E00, 0x7038E07, 0x7038E38, 0x7038E3F, 0x7038FC0, 0x7038FC7, 0x7038FF8, 0x7038FFF,
+    0x703F000, 0x703F007, 0x703F038, 0x703F03F, 0x703F1C0, 0x703F1C7, 0x703F1F8, 0x703F1FF,
+    0x703FE00, 0x703FE07, 0x703FE38, 0x703FE3F, 0x703FFC0, 0x703FFC7, 0x703FFF8, 0x703FFFF,
+    0x71C0000, 0x71C0007, 0x71C0038, 0x71C003F, 0x71C01C0, 0x71C01C7, 0x71C01F8, 0x71C01FF,
+    0x71C0E00, 0x71C0E07, 0x71C0E38, 0x71C0E3F, 0x71C0FC0, 0x71C0FC7, 0x71C0FF8, 0x71C0FFF,
+    0x71C7000, 0x71C7007, 0x71C7038, 0x71C703F, 0x71C71C0, 0x71C71C7, 0x71C71F8, 0x71C71FF,
+    0x71C7E00, 0x71C7E07, 0x71C7E38, 0x71C7E3F, 0x71C7FC0, 0x71C7FC7, 0x71C7FF8, 0x71C7FFF,
+    0x71F8000, 0x71F8007, 0x71F8038, 0x71F803F, 0x71F81C0, 0x71F81C7, 0x71F81F8, 0x71F81FF,
+    0x71F8E00, 0x71F8E07, 0x71F8E38, 0x71F8E3F, 0x71F8FC0, 0x71F8FC7, 0x71F8FF8, 0x71F8FFF,
+    0x71FF000, 0x71FF007, 0x71FF038, 0x71FF03F, 0x71FF1C0, 0x71FF1C7, 0x71FF1F8, 0x71FF1FF,
+    0x71FFE00, 0x71FFE07, 0x71FFE38, 0x71FFE3F, 0x71FFFC0, 0x71FFFC7, 0x71FFFF8, 0x71FFFFF,
+    0x7E00000, 0x7E00007, 0x7E00038, 0x7E0003F, 0x7E001C0, 0x7E001C7, 0x7E001F8, 0x7E001FF,
+    0x7E00E00, 0x7E00E07, 0x7E00E38, 0x7E00E3F, 0x7E00FC0, 0x7E00FC7, 0x7E00FF8, 0x7E00FFF,
+    0x7E07000, 0x7E07007, 0x7E07038, 0x7E0703F, 0x7E071C0, 0x7E071C7, 0x7E071F8, 0x7E071FF,
+    0x7E07E00, 0x7E07E07, 0x7E07E38, 0x7E07E3F, 0x7E07FC0, 0x7E07FC7, 0x7E07FF8, 0x7E07FFF,
+    0x7E38000, 0x7E38007, 0x7E38038, 0x7E3803F, 0x7E381C0, 0x7E381C7, 0x7E381F8, 0x7E381FF,
+    0x7E38E00, 0x7E38E07, 0x7E38E38, 0x7E38E3F, 0x7E38FC0, 0x7E38FC7, 0x7E38FF8, 0x7E38FFF,
+    0x7E3F000, 0x7E3F007, 0x7E3F038, 0x7E3F03F, 0x7E3F1C0, 0x7E3F1C7, 0x7E3F1F8, 0x7E3F1FF,
+    0x7E3FE00, 0x7E3FE07, 0x7E3FE38, 0x7E3FE3F, 0x7E3FFC0, 0x7E3FFC7, 0x7E3FFF8, 0x7E3FFFF,
+    0x7FC0000, 0x7FC0007, 0x7FC0038, 0x7FC003F, 0x7FC01C0, 0x7FC01C7, 0x7FC01F8, 0x7FC01FF,
+    0x7FC0E00, 0x7FC0E07, 0x7FC0E38, 0x7FC0E3F, 0x7FC0FC0, 0x7FC0FC7, 0x7FC0FF8, 0x7FC0FFF,
+    0x7FC7000, 0x7FC7007, 0x7FC7038, 0x7FC703F, 0x7FC71C0, 0x7FC71C7, 0x7FC71F8, 0x7FC71FF,
+    0x7FC7E00, 0x7FC7E07, 0x7FC7E38, 0x7FC7E3F, 0x7FC7FC0, 0x7FC7FC7, 0x7FC7FF8, 0x7FC7FFF,
+    0x7FF8000, 0x7FF8007, 0x7FF8038, 0x7FF803F, 0x7FF81C0, 0x7FF81C7, 0x7FF81F8, 0x7FF81FF,
+    0x7FF8E00, 0x7FF8E07, 0x7FF8E38, 0x7FF8E3F, 0x7FF8FC0, 0x7FF8FC7, 0x7FF8FF8, 0x7FF8FFF,
+    0x7FFF000, 0x7FFF007, 0x7FFF038, 0x7FFF03F, 0x7FFF1C0, 0x7FFF1C7, 0x7FFF1F8, 0x7FFF1FF,
+    0x7FFFE00, 0x7FFFE07, 0x7FFFE38, 0x7FFFE3F, 0x7FFFFC0, 0x7FFFFC7, 0x7FFFFF8, 0x7FFFFFF,
+};
+
+// Random key per cell and value; value 0 (empty) is 0 so it drops out of the XOR
+static const unsigned long long zobrist[NUM_CELLS][10] = {
+    { 0x0ULL, 0xBB4E745D51E25991ULL, 0x40EA4064CC8FD7F1ULL,
+      0x6EE72C051064834AULL, 0x15B6247B34B65EE3ULL, 0xC7CAECAA719A3491ULL,
+      0x26723ADACF2C64B8ULL, 0x9EF1C90DF704E0EEULL, 0xEC5593B66D4C0F92ULL,
+      0x6A962931C1FFCD25ULL },
+    { 0x0ULL, 0x5C01798D26D34DB4ULL, 0xF80A92EC1BFDA817ULL,
+      0xE65D71957506A172ULL, 0x5424AA1F892BEA52ULL, 0xFD2CC86F00F73B57ULL,
+      0x4A6D5703C9B24EE9ULL, 0xFB65D0DC362E5885ULL, 0x9463A6FE8B801090ULL,
+      0x1B3A8E49BE028103ULL },
+    { 0x0ULL, 0x1E8B1488F5ECC0F7ULL, 0x1DEF59C621F0EFA6ULL,
+      0xA1AB954C61D15BD0ULL, 0x7302BCFEEC519DDBULL, 0x77687BD18B0F11B1ULL,
+      0x351BCD89AAECB354ULL, 0x38B5B67540128275ULL, 0xD7A381865C416B60ULL,
+      0xCFA77355856226F1ULL },
+    { 0x0ULL, 0xFD43C706C74694D9ULL, 0x48371922D4D9DF5FULL,
+      0xD4E3843F83491585ULL, 0x5E975F38BF6CAFC8ULL, 0x1B220E34AD6E234AULL,
+      0xD004019394F5C618ULL, 0x6F9FFA00380CED52ULL, 0xAAAA7547018B4C73ULL,
+      0xAAD421D065C1E17AULL },
+    { 0x0ULL, 0x39CBF358E79E77F8ULL, 0x6605E2ABB8E029BCULL,
+      0xD515D98274C5D6A5ULL, 0x0E159DFAF63E9DFAULL, 0x66F3BA570AC604CDULL,
+      0x9E30274652BA6E57ULL, 0x2E2CAA46243C561DULL, 0x1254EA0077AD13F1ULL,
+      0xC563603DA535239FULL },
+    { 0x0ULL, 0x2AD3DD3ABC1FB355ULL, 0x9BD4A875BF5EC291ULL,
+      0xD4B3A02225F4570FULL, 0x4BE781697AC8427DULL, 0x85AA983A580F48B0ULL,
+      0x97220E3F4D7E5E4FULL, 0xCAB8274B30B48136ULL, 0x0EACEA75E84CBEC3ULL,
+      0xD39908299CC3644EULL },
+    { 0x0ULL, 0xFFF7E912CCA9674BULL, 0xE154671F861C9E4CULL,
+      0xF2ECB078859F2CC6ULL, 0x3580A7C7947ED87EULL, 0x87775D87DC2E18C5ULL,
+      0x8F1061E1775CAB0DULL, 0xCB7ED398B06AAD23ULL, 0xE5984F24777870D2ULL,
+      0xE0862EF04338FD7FULL },
+    { 0x0ULL, 0x5BE99298DDC0E1EDULL, 0xA222AACD45552CDFULL,
+      0x32059B08AEFC35A0ULL, 0xF673D7D6519C3946ULL, 0x12D1EEC58B0869CCULL,
+      0x41FB0BFEC54AC37AULL, 0xFB2BE1C32A1100A4ULL, 0xB64483662A6EAAEFULL,
+      0x2FAB25FA90042EC0ULL },
+    { 0x0ULL, 0x89D5529A652BBE0CULL, 0x1382D2C52C190029ULL,
+      0xA94552BA8C5A1693ULL, 0x66D9AC7F2611CB1CULL, 0x64FBEB80DDF7A62FULL,
+      0x3EC22A4696EEF78EULL, 0x69F160C7A9CCA3E5ULL, 0x5D123396A71AA806ULL,
+      0x210F50DD56A587A0ULL },
+    { 0x0ULL, 0xB5A16F2374CC29EEULL, 0x7154A41C0086C744ULL,
+      0x66ACBA38F9379286ULL, 0xAE25FD8B538A1BF0ULL, 0x003C898E76FE44E9ULL,
+      0xCCE901F449D8B912ULL, 0xCC112B8DEC07AC9FULL, 0x09003F76439A0A16ULL,
+      0xBE5F027ABDCF8017ULL },
+    { 0x0ULL, 0x900C59D07D79A4E9ULL, 0x6553AB40B58B6814ULL,
+      0x2C73B7D79D83469CULL, 0x9BE0E282D61D1A72ULL, 0xF1CAE87B891F23CAULL,
+      0x1A596A741F1F362EULL, 0xAE0150C2BE1E9655ULL, 0xF331D8357AD55EB5ULL,
+      0xF6787C2317820283ULL },
+    { 0x0ULL, 0xC83D3DD3F48C9EA0ULL, 0xCEB0AAA152D9B05DULL,
+      0x308CBCF32C382680ULL, 0x50FBC86518713835ULL, 0x95CD492FC9E5A766ULL,
+      0x23B1752D510357ABULL, 0x4605C5FFC7342EBEULL, 0xB5C7C502FEFBC9D9ULL,
+      0x7BC873CF7DE21884ULL },
+    { 0x0ULL, 0x85A53E5DDB343F4BULL, 0xCDE0AAE58520F84CULL,
+      0x91DC5B2056F9897DULL, 0xB1E4590BC3E86370ULL, 0xC803C9D5F67E5539ULL,
+      0xA5C4C83A83FB06D0ULL, 0x90F844843AB56CC6ULL, 0xF86D574C104BC13CULL,
+      0x0F174B5D80F6B139ULL },
+    { 0x0ULL, 0x06DDA02F32574335ULL, 0xF58AFA95DD8F1FDFULL,
+      0x2A84A83667495E8DULL, 0x8055AB34B31F8076ULL, 0x3C262E9EE8A61BB1ULL,
+      0x5F1478C0D00E78B5ULL, 0x13585DFEA8F99084ULL, 0xFE9BEEAD40AEE134ULL,
+      0xDB90D9BDE74941EFULL },
+    { 0x0ULL, 0x6844E1D91CA14DBAULL, 0xAA8442680883D151ULL,
+      0x4C3900DB1A2E59CDULL, 0x025193B5C0E1F02EULL, 0x8C689B5F44F0AE64ULL,
+      0x6A7728CED7CE12EDULL, 0x9AEB08A6838DBFCDULL, 0x98CA63F3DD52D854ULL,
+      0x0F19602C359757DAULL },
+    { 0x0ULL, 0xB07D9AA225C07C0AULL, 0xE1A67742571C4545ULL,
+      0xE497E186857D47C6ULL, 0xD4934A8F228C23C2ULL, 0x8704B9CA8EDAE82EULL,
+      0x0B3B3C59EE3E1016ULL, 0xCF6FFE2AF6666748ULL, 0x749C6A68B404558EULL,
+      0x58992E42FD6C9DBDULL },
+    { 0x0ULL, 0xE701B4811707B6DFULL, 0xC497A309719FA87CULL,
+      0x46FFC57B1CC98573ULL, 0x83C0B63CE010A276ULL, 0x3DCBFA0C9C8136F6ULL,
+      0xB3A92493620EFFADULL, 0x312C682317A664CAULL, 0xC075A95720622FADULL,
+      0x2945813566707E84ULL },
+    { 0x0ULL, 0x4D7D3E0E673B2EF7ULL, 0x888193C42B9B0F3DULL,
+      0x3241C719348F9942ULL, 0xE382D0E534D3D0A1ULL, 0x997DFF5A04075125ULL,
+      0x47F859AA767AA805ULL, 0x97C2C520AAD64DD7ULL, 0xF1F2625918517528ULL,
+      0x8710F0FF00595B73ULL },
+    { 0x0ULL, 0x4F9092AB094D4636ULL, 0x7290B4BF44733C90ULL,
+      0x60122FE19E96C993ULL, 0x383F513FCE5CD86DULL, 0x5311D1AD8D234C5AULL,
+      0xDF8010D12AE1F965ULL, 0x0FC837D8100A3941ULL, 0xC4BD29C4FAC5C57DULL,
+      0x8DCC967B8E9D6A2FULL },
+    { 0x0ULL, 0xEEAFE92780045691ULL, 0xD2114B307E4F9945ULL,
+      0xD7478AD75DAEC24CULL, 0xC10C7E3B3F5B3CC9ULL, 0x4A6956B3345F3F3CULL,
+      0x896CF72F41715731ULL, 0x0D3FAFB5F1739599ULL, 0x5411FAC1F10B44B7ULL,
+      0xFAD4917ED3D8670DULL },
+    { 0x0ULL, 0x6D5A42FC6248FEF9ULL, 0x597238B8B3CCFB6DULL,
+      0x767DC805CAB1B6D2ULL, 0x8FE812B86DDA4797ULL, 0x69BD44A6B5F9F88CULL,
+      0x05F92FBCF0E36CDFULL, 0xB0CC993B9A64A1E2ULL, 0x87ECEACCA3A9C500ULL,
+      0x026A36BE25C89995ULL },
+    { 0x0ULL, 0x907AB84404C48302ULL, 0xB404E7FC1643F143ULL,
+      0xB410BB0B5576076BULL, 0xD28ADC4B4219ED65ULL, 0xF7140517A8AAEECBULL,
+      0x75EA719CB559852AULL, 0x536D5A2EC5F889EFULL, 0x063D0818B51D1110ULL,
+      0x4A5FA9D398FA7C85ULL },
+    { 0x0ULL, 0x9B117C476C04FEE5ULL, 0x43711AA28A8BE974ULL,
+      0xBC1F1F1B482CBFB8ULL, 0x98BD535A7EF3561EULL, 0xFCA3FA36E89C67A2ULL,
+      0x03FAEB4DABC73667ULL, 0x34F0BAD78D6FCFA3ULL, 0x78278D2A15E776D8ULL,
+      0xE14778B6309268A2ULL },
+    { 0x0ULL, 0xB8ACE3D1803302D5ULL, 0xA628AC280FC3A6E8ULL,
+      0x77E244EACB75A4AEULL, 0x89085E7BBC0CF54EULL, 0x5ACC9290B316C929ULL,
+      0xBBDAD02AD4E2268CULL, 0x3C86D3AF0A989C7CULL, 0xBD5D1E287B8DC627ULL,
+      0xB4B88611B14EF69DULL },
+    { 0x0ULL, 0x4D672CADA6B0230BULL, 0xD17E7B2D1AC5D1C5ULL,
+      0x1C772505AD5CA71AULL, 0x08FF2160B45B57B8ULL, 0x8B066A0E11AF21D6ULL,
+      0xE5DF74B3014A0B08ULL, 0x97ED4A3C746B7DB6ULL, 0x41F2168D4656C5C9ULL,
+      0xFA36F382B4F8EEEFULL },
+    { 0x0ULL, 0x2EBFDB06760E5ED1ULL, 0x9C1798B90FA18040ULL,
+      0xBE5013FB8530A0D2ULL, 0xE4346E5A508841A3ULL, 0x2F452C50DE6D1695ULL,
+      0x564CA52B566ECDF5ULL, 0x6057155B05041A41ULL, 0xA1C0C7829BFAFE17ULL,
+      0xD254E8BCC6D105FAULL },
+    { 0x0ULL, 0xDB09A749B054B8CAULL, 0x05464BCC5FDA62EBULL,
+      0x25E002564ABEC6B3ULL, 0xA2A38E435D2D6955ULL, 0x5B937719F36CD76DULL,
+      0x9A4D454AF6AC43A8ULL, 0x09F4D113FDB641BFULL, 0x1ECADA09DD009BCDULL,
+      0x6027B4ED153C600AULL },
+    { 0x0ULL, 0x5231925A8EBDDA06ULL, 0xEA523516C0803D8DULL,
+      0x85C756AFD158A3A4ULL, 0x883DB9C4667F651FULL, 0x3AC6EE93170BE896ULL,
+      0x3247DC241693342CULL, 0x700DD256C3DE14D4ULL, 0x7C161825F291747FULL,
+      0x3BC801D86ECB43D4ULL },
+    { 0x0ULL, 0xEA29076643B2A6C3ULL, 0x2D673145953753D8ULL,
+      0x28A8815D9F3F4EB0ULL, 0x340CD56184BF8436ULL, 0xACACAECE14A5A3FCULL,
+      0x62913F43EFE137A0ULL, 0x62F1F83FABDD3CD1ULL, 0xD4E5EC172D1C5DF8ULL,
+      0xF47C528E24786F06ULL },
+    { 0x0ULL, 0xA98BAAD04329AAFAULL, 0x0FE59EB37D9BF63AULL,
+      0xE1A830F50F25CE30ULL, 0x2DC9D95CED1E4377ULL, 0xC148933CBAAC8429ULL,
+      0x39E7E9A434C71903ULL, 0xF2ECB3273FBE99B9ULL, 0x0639DFE2FAC1C07EULL,
+      0xA74B59D904EC0AE9ULL },
+    { 0x0ULL, 0xE586940C7AAB5C37ULL, 0x8D26E68F4AD79BDCULL,
+      0xB4B62B535DD3E167ULL, 0xA0F435CD8AD93A65ULL, 0xA554A9E00D0152D9ULL,
+      0xB77779B493427D39ULL, 0xB5654C5B4F7FF088ULL, 0x5FB359D447B72105ULL,
+      0x7A3D43565F3197F3ULL },
+    { 0x0ULL, 0xB66841942622716EULL, 0x02FCCEEC8456BF64ULL,
+      0x6F893C76F0DBF8D2ULL, 0x76BA21CA3B8E9CE0ULL, 0xB1B3F4C0BBDB911CULL,
+      0x31D96EF5DC3C1B96ULL, 0x00E02F180C41E092ULL, 0x9CB52AACBDEA623FULL,
+      0x252A2262C3D6840BULL },
+    { 0x0ULL, 0xC47BF193EBEF8775ULL, 0xEB16F08DDCAC56A0ULL,
+      0x04042D71FA0DFCF0ULL, 0x0B447240E6BD5583ULL, 0x5169BA4571523AE1ULL,
+      0xC7AA9027DBAAC51BULL, 0x6707F2283A04F5FDULL, 0xEBBBE80BBFB72169ULL,
+      0xDF0BC9AE7482BEEFULL },
+    { 0x0ULL, 0xBA00A928050F82E6ULL, 0x2166C77B00954054ULL,
+      0x9051EB9882CBC6E5ULL, 0xBCF4830F3BDE415EULL, 0xF46ECE951C38AD09ULL,
+      0x8DD5C463A4F3A8D7ULL, 0xCCBF82D27997B6F1ULL, 0xE1C0EB9159D64C41ULL,
+      0x35A5479832173B90ULL },
+    { 0x0ULL, 0x2572ADDB468A4887ULL, 0x1D5C19D5008EB2D1ULL,
+      0x3B5502F5E4F0A80EULL, 0xAB33E2055A372B61ULL, 0xFDC8442ABB307459ULL,
+      0x21D5FB784180639DULL, 0xDE919F4FED1C28DEULL, 0xC700E859C2B1D5F5ULL,
+      0x182E58DD29E6B1C0ULL },
+    { 0x0ULL, 0xB95893F99DC57A32ULL, 0x42136F3F2304A53EULL,
+      0x24BC7F9F235C1FB7ULL, 0x9F08ECF250046952ULL, 0x3DC1695350F2701CULL,
+      0xFB48A7E821B2C060ULL, 0x5B4D710D73A68D48ULL, 0x4AB334B8896B8992ULL,
+      0x1D5E433AD786E1ECULL },
+    { 0x0ULL, 0x15120BF9224DC012ULL, 0x3011AB3B52C664CDULL,
+      0x7F4F910C14D9EB12ULL, 0x57716C60E6B11685ULL, 0xE7743B2A3D2B4D33ULL,
+      0xF631F60D99FB9E22ULL, 0x3A852BF2DC690F48ULL, 0xF76D9723E598CC1EULL,
+      0x166059284C4CB29DULL },
+    { 0x0ULL, 0xE3C3A4A4292A33DDULL, 0x1849A201E920BF14ULL,
+      0xEF228883E4250343ULL, 0x142C2943B8BE0C7FULL, 0x35DC846AC8A28E16ULL,
+      0xE0674A81D1CED2B3ULL, 0xE25BEFD7A4F42E6DULL, 0x569F0F660B1C82D1ULL,
+      0x89FB40BCBE196AD3ULL },
+    { 0x0ULL, 0x78F439EC05BCB7E8ULL, 0x73241A5BADFB3D5BULL,
+      0x253BBD9924A96ABAULL, 0xF249D29F4DEBDCFDULL, 0x0F22B77EC8B1D9ABULL,
+      0x503420ACCD86A947ULL, 0x9F9DC8335A0FDA73ULL, 0xE81C9197F76CD3D9ULL,
+      0x73C6AA5325EDE2F1ULL },
+    { 0x0ULL, 0xD8DFF9C3A6E26DE6ULL, 0xEC677E893645F280ULL,
+      0x54538B9A344023F2ULL, 0x11030597FDC6C532ULL, 0x70CC61B8D7E4B53DULL,
+      0x9D4F252BB5BB4940ULL, 0xD967B615D91DF6F9ULL, 0x0F22ACD646D2B5FCULL,
+      0x1FD5A58CE693458CULL },
+    { 0x0ULL, 0xD6C2773896F2B344ULL, 0x02892B68A9235D45ULL,
+      0xD8F175BE2D0C8D70ULL, 0xA8A719DF02F8BF08ULL, 0x1BFFC3A2FD23C315ULL,
+      0xF00BE299ECFEAA6FULL, 0xD926655ECF2D1DB3ULL, 0xAA95323F269EADF0ULL,
+      0x2978F7D22E7F7E93ULL },
+    { 0x0ULL, 0xD360B7CFC4264514ULL, 0xA0525733DF7D65EBULL,
+      0x8C374DEFCFA2BA96ULL, 0x52AF0E6A10323E9AULL, 0x3A626F84635EFC51ULL,
+      0xDEB352A7CCF0F1BCULL, 0x7E9041A3824CB019ULL, 0x23AD7E14A609F6DDULL,
+      0x49F4C44E405EDE56ULL },
+    { 0x0ULL, 0x954F2C96974C3C35ULL, 0xF6E9B03A17BF88B8ULL,
+      0x08A033C29604350CULL, 0x979E7F3FAA4760F3ULL, 0x8696E93CFEA12AF5ULL,
+      0x7D23F47B82B210A2ULL, 0x7BAB849C5705430CULL, 0x87FFC2A28A3EDB26ULL,
+      0xF574169328E3A6E4ULL },
+    { 0x0ULL, 0xF1955E33DA218B2BULL, 0x68552B143A420D36ULL,
+      0x125E7100C7A6C98EULL, 0x1CE228CCB7B0EFCBULL, 0x25EDC81D2D060EABULL,
+      0xF2FC625BCC0CAE19ULL, 0xAC4F27345ABD0EC8ULL, 0x5F9BC496F926D409ULL,
+      0x34FC5990B1B36BD9ULL },
+    { 0x0ULL, 0x1009589F9971DDA5ULL, 0x89C328E0EFAFF067ULL,
+      0x7C1D2DDF0C41015EULL, 0x6D54B1463330845AULL, 0x07154B8E820F753EULL,
+      0xD3F84507505B16ACULL, 0x0A28ED658B09E639ULL, 0xD63A82794E52F76EULL,
+      0xE5D4F0810DF32AEBULL },
+    { 0x0ULL, 0xEB1E144BDDB43908ULL, 0xD5EDB3CA3A19018AULL,
+      0xFA0FBB56B41AF97DULL, 0x8B1F2E72704277A8ULL, 0x70E7A341CC8174C8ULL,
+      0x7FD2529A5311E5F1ULL, 0xA2C7663F958B165BULL, 0x026FC04B00010DD0ULL,
+      0x63E5937B60148BF7ULL },
+    { 0x0ULL, 0x9BD1DE867964505CULL, 0xB8DC7CF63FD97053ULL,
+      0x0EB3A8A28CC276F7ULL, 0x014A0FC1BEE3E6A0ULL, 0xBCA8C54426AB0245ULL,
+      0xE42C4A68827A28A0ULL, 0x011B4CE06571B425ULL, 0x1BBAF99558BF18DAULL,
+      0x46B7474E21D190ECULL },
+    { 0x0ULL, 0x4188435A7BEBFDD3ULL, 0x7B45CF5E184BCFBFULL,
+      0xAA43AE3C6F341409ULL, 0x0B0C78D7AAF5F341ULL, 0xB469FE3460786D54ULL,
+      0x4A6CE6E89DB26A8AULL, 0xC797015E47C7A451ULL, 0x180ED8F72AA8F5EDULL,
+      0x057E89E0BF08E8D2ULL },
+    { 0x0ULL, 0x050529173886ABEAULL, 0x6890845AFAA5227DULL,
+      0xDA708DA5AB92A59FULL, 0xF585D87CCAF7512FULL, 0xA96D74F22D1410C1ULL,
+      0xFF4CA1A9E30EC4E0ULL, 0x390844EF23CC171BULL, 0x47A1C5A986881604ULL,
+      0xE8F5AD9CD0EB6293ULL },
+    { 0x0ULL, 0xB61917CF977FCBBCULL, 0x8EFB7BB298B1B01FULL,
+      0x55381DEB06D57CD2ULL, 0x1E36308C83294044ULL, 0xF554C88A251E3BE3ULL,
+      0x720226E0B318DEF3ULL, 0x31636EA2D772C83BULL, 0xFF6AF59AB47230B1ULL,
+      0x81BEE813955FC37EULL },
+    { 0x0ULL, 0x4DEF43F669EDD7B3ULL, 0x6EF7C1FAFCA209FBULL,
+      0x7CB852C2E37CA558ULL, 0x5D74F32D2BA351DFULL, 0xC1006E80C0B19968ULL,
+      0xBEDAD4E2B4BCC4B1ULL, 0x74E1BEDB9FC54DA0ULL, 0x427806B71D43E8F9ULL,
+      0xD8B19748ADFF1622ULL },
+    { 0x0ULL, 0x3405315674CA348EULL, 0xEA29D04D132AA9DFULL,
+      0xF182F06BD63D8C16ULL, 0xB7FD8BC67D23F69EULL, 0xAC9C4A2B9488D829ULL,
+      0x299B20BADD56C5FDULL, 0x8F574D1E50D62707ULL, 0xBA7A40724BF212B0ULL,
+      0x0561EB4F545BE56BULL },
+    { 0x0ULL, 0xFB06BFDCF5BFB885ULL, 0xA1D675F1BF644498ULL,
+      0x5F71595256C4DA6EULL, 0x7E224E029B11ABC0ULL, 0xC18F8F50A4C1A3BAULL,
+      0xA2A9631EE54378C0ULL, 0x7FFB3928B45ADD3EULL, 0x93121A42881D958DULL,
+      0xC5485506091230E0ULL },
+    { 0x0ULL, 0xE70891C88C092343ULL, 0xED7A98C9324C0AAFULL,
+      0xFF3D7A6CDA9533B0ULL, 0x4F1EEBC9A5F6A0B1ULL, 0xC623E3A84E82C3DDULL,
+      0x508FC90BCA643CEBULL, 0xEB564197F09FE7C8ULL, 0xD0E0218694184332ULL,
+      0x6228F8EDA16C5116ULL },
+    { 0x0ULL, 0x77B97C3D0D738CD9ULL, 0xB5ADA7EC73A75104ULL,
+      0xEE765D6F80B643E0ULL, 0x94136E7259EA9A75ULL, 0x72DB311EEDEE2879ULL,
+      0xEB874840E8640115ULL, 0x4334DCF3C0399D3CULL, 0xDC9A5A049896F27CULL,
+      0x7B7A4C9FAD218A20ULL },
+    { 0x0ULL, 0x2024F39C6D1E487CULL, 0x4C6CA8F0B24B8EA1ULL,
+      0x0DD14B5A375B93FCULL, 0xB4EF2AC2F12BEBC5ULL, 0x9F5D036A50EA6B9CULL,
+      0x78991097301322A8ULL, 0x438FD9DB74FEE32AULL, 0xAC2E91CBE5E0FCF7ULL,
+      0x834DB2A056817997ULL },
+    { 0x0ULL, 0x1DB763932C996223ULL, 0x489CC2BD36883E33ULL,
+      0x9CCCA0A7E16D476AULL, 0x838EABF9B08261A5ULL, 0x807DE8AC12B94C78ULL,
+      0x44E479BAA7515BC0ULL, 0xB69C131AE2C86EFAULL, 0xAF65E19B59EEA59DULL,
+      0x0C5575C7C96453A5ULL },
+    { 0x0ULL, 0x26AC8AF58A8A9E4EULL, 0xC744F56144402F37ULL,
+      0x637FD37A66E1D10AULL, 0xB9759B57CF31595CULL, 0xE1353AD48ADA43C8ULL,
+      0x5B6CDEE3555F5E83ULL, 0x7AD450875D375971ULL, 0x89BE9D9E2B81C005ULL,
+      0x446F1F1ED0F2EBFBULL },
+    { 0x0ULL, 0xE96A7345FBEC9C7EULL, 0x61E2080762399250ULL,
+      0xB53756DCE90D3334ULL, 0x5B0AD1637D0BC8F3ULL, 0xCDFBF6C2F697EDE7ULL,
+      0x8D307FADED32EF07ULL, 0x13E9600877EAC516ULL, 0xA0CD2468A37690A8ULL,
+      0xFC9CF1EC9ED3C0D2ULL },
+    { 0x0ULL, 0xA28095887308F510ULL, 0x8C6DA55051E087D1ULL,
+      0x3C23A22F548AB6ECULL, 0x7ABE552EB233DAAAULL, 0x1C598B83D402E499ULL,
+      0x4C8506935A95FE45ULL, 0xA08EF47A3B332ACAULL, 0x58051EB12A1C8DFAULL,
+      0xAFBEF924F8FDBC8AULL },
+    { 0x0ULL, 0x4B4A13E84C8E58CDULL, 0x16E7FE5D81BCB28EULL,
+      0x0FA2E41E6D1BB3C4ULL, 0x13002D6893A4D064ULL, 0x20F6E7633346EC7EULL,
+      0x3F18C2520C0F5122ULL, 0xB01FB12C8FBB36C2ULL, 0x6CAB4FF447E94C79ULL,
+      0x8C246C149507592DULL },
+    { 0x0ULL, 0x19080D91FFAA1360ULL, 0xF7D1D7272B19CBC3ULL,
+      0x9A7468F6948A03B8ULL, 0x8FEBC12A66269005ULL, 0xEA91687383A7D596ULL,
+      0xF7CE184109DDDC13ULL, 0x3723DB74C1F64DC6ULL, 0xC32A615BA5E3A366ULL,
+      0x73D696F992B10388ULL },
+    { 0x0ULL, 0x699FD76D3047C446ULL, 0xCDD77DDE4D739092ULL,
+      0xB20DD46E34E5D2E5ULL, 0x48F287C4DB611F4FULL, 0x212E7CF5864BB2DDULL,
+      0x2F1021F8155F250CULL, 0x9A5E079B64CF2994ULL, 0x00959BF21E79993EULL,
+      0x99F7055AD4CD0D44ULL },
+    { 0x0ULL, 0x62B2E44421B58377ULL, 0x5EAE8CC6AE9E8FCFULL,
+      0xEB5A50DCBAEDE37FULL, 0xC499A142FD328A3AULL, 0xFDB8794A873056ADULL,
+      0xB0BC8A91D82B8050ULL, 0xBAEDED6B984F616BULL, 0x8240D03983979323ULL,
+      0x888315A01F82E9EBULL },
+    { 0x0ULL, 0xA4DC2F229439A9D2ULL, 0xFE8B64BD6B9E317AULL,
+      0x963C90A8B0CE0480ULL, 0x8E5B7F3E1F1962AFULL, 0xC3939DEFC371D466ULL,
+      0xA410BE1B4773B39DULL, 0x45379357A5535DBDULL, 0x59FE7F0B8C1086A7ULL,
+      0x09AB817D1E7D9E6DULL },
+    { 0x0ULL, 0x1FB14A85BEDFC1AEULL, 0xE263F36AE7D39646ULL,
+      0xEE3F4F6A76344962ULL, 0xCBE7D1C6ECB6CFE6ULL, 0xF746331DA5176B47ULL,
+      0xC78D4B15E13111E4ULL, 0x23A463520FE4B138ULL, 0xB90ABA1E6FE9BCC9ULL,
+      0x1245FB6B8A06A244ULL },
+    { 0x0ULL, 0xCCA8A6C8E67C5854ULL, 0xD1E89B4516C95BA2ULL,
+      0xDDAF23EF61AB74ADULL, 0xE5E86160B3CC1BD3ULL, 0xACFD9369EC5B3AE7ULL,
+      0x9FFB924D2304D4D4ULL, 0x62662CB1C67B859CULL, 0xD8C17DE5AE6B414AULL,
+      0xBF00483EBDCE3FCEULL },
+    { 0x0ULL, 0x3B34A90CF27A238BULL, 0xDD85A57ED0A5F79DULL,
+      0x036C522C43E3C494ULL, 0x2B8969CEA2DAA857ULL, 0x601DD6D7642243A5ULL,
+      0x31444E9E77BD96F7ULL, 0x7C52F5B7238EE9DCULL, 0xF46FFD4685B25A6FULL,
+      0xDCC0D3E021937BB8ULL },
+    { 0x0ULL, 0x3F9A8BC7B1476EEEULL, 0x3B98DD4F7EBC0956ULL,
+      0x3B23F8775CFE79D0ULL, 0x969FB98216881C2EULL, 0xDAF1EC77352808EBULL,
+      0xD8FE4B1C58B9B8DEULL, 0xBEFB149A0783EC6CULL, 0x9D867D20280228FFULL,
+      0x5FE18A5888F1A356ULL },
+    { 0x0ULL, 0xC8A0564433972A9EULL, 0x72AA40C6C438179BULL,
+      0x62E2B555E40A003DULL, 0x6681E44E0F6BA469ULL, 0xD8942A08897C4864ULL,
+      0xB924A3B35BA7F427ULL, 0xEF90AA31A9B518F0ULL, 0x5BBC5EF98F8FB73DULL,
+      0x1916AA9203405355ULL },
+    { 0x0ULL, 0xDF2873CC047FA362ULL, 0xBFBD8F30BA903BA2ULL,
+      0x513359E61F6B9C0DULL, 0x040284F1C724890DULL, 0x3F05FEB0FCC086BEULL,
+      0xAF931BE7A1796883ULL, 0xAD9B0F5C4D9E02D1ULL, 0xC119F8C101F63186ULL,
+      0xAA960611A14CC146ULL },
+    { 0x0ULL, 0x186AB4B4A73C9AABULL, 0x9199F77376E4EE4BULL,
+      0x323EB7B602965446ULL, 0x81A56C6963CF13CBULL, 0x338337F49DB1E3E2ULL,
+      0x11C574550906FF86ULL, 0x7A48F21C4C01CB43ULL, 0xC661E251FB8B6180ULL,
+      0xFE81E018CB232946ULL },
+    { 0x0ULL, 0x818563FFA15B0787ULL, 0x8F037372D14DAA57ULL,
+      0x05786C257D18A974ULL, 0xD82FB64A6B91F235ULL, 0xB0D5F6DD64B9FD99ULL,
+      0xF97292E83760E187ULL, 0xFA76C6388450327DULL, 0x5CA2F2F9E3E6B8C6ULL,
+      0x344861BD2417585FULL },
+    { 0x0ULL, 0xB06DD58B1322BFBFULL, 0xD5CAC0F60008B0BDULL,
+      0x84CDCC7D101F4043ULL, 0x04E473F78DD511E1ULL, 0x5F289E17D88C4026ULL,
+      0x6CB5EA015BC712D4ULL, 0xA8034B4452F5B657ULL, 0x8B16BDB74A616CE4ULL,
+      0x37FE2E48426A31E9ULL },
+    { 0x0ULL, 0x69810B6838D2D558ULL, 0x8B81A48CA8068ABCULL,
+      0xDCB527B1E652E54CULL, 0x1597966E81A9C32DULL, 0x8F3FD8067A7104FCULL,
+      0xB914D04E7196CCD1ULL, 0xEEA2C2EB821DEB76ULL, 0x5671968D525F6887ULL,
+      0x1A2F1D795E959A57ULL },
+    { 0x0ULL, 0x4A0EEBAEA28496FDULL, 0x010196B4A5A0E587ULL,
+      0x65AA7ABBC83C9813ULL, 0x93174CB480DAFE1DULL, 0x0D3C65E345801B07ULL,
+      0x2E41A6D8B9AD93A1ULL, 0x837EC62ADFFC1822ULL, 0x42B3E1C79D4725BFULL,
+      0xA3039BA06E240A3BULL },
+    { 0x0ULL, 0x24EE725E53BA1AAFULL, 0x51749ACB7A605DD1ULL,
+      0x676B12109EF0C4A3ULL, 0x40EB182CFD79A08EULL, 0x04E5836DEBB5B4C1ULL,
+      0xB7C8BC7CF3DE178BULL, 0x8ABC291F8A2185DFULL, 0x859C88157253D912ULL,
+      0x62226B686493E89AULL },
+    { 0x0ULL, 0xF4E5B21DBC12274EULL, 0xA0191699452E6828ULL,
+      0x6047E084C8656144ULL, 0x1AE7C5F0A1E484E0ULL, 0xAFFD98A61D3CB9CEULL,
+      0xA63C702BC77E2AD0ULL, 0x79A5832CAD51978BULL, 0x194D9A351A7CCC53ULL,
+      0xD392E58A926D84A0ULL },
+    { 0x0ULL, 0xFAC7B4C074CF7AFFULL, 0x2EEF5325E9634309ULL,
+      0x75D02C83FD860777ULL, 0x1947D4B5D1119FE3ULL, 0xF731D3E44041E56FULL,
+      0xC8C203256DB4D3F2ULL, 0xEDF8AB489B446F37ULL, 0x98A7CF224FA48499ULL,
+      0x9854E094A415A85CULL },
+    { 0x0ULL, 0x4AAC3D2C252FC78BULL, 0x825716F5B147F2F2ULL,
+      0x248349FB5CF09C40ULL, 0x9370668B44A98C44ULL, 0x6EFC44BFDA05F879ULL,
+      0xB9C4C844AFFF9A65ULL, 0x29782A16B75A01F5ULL, 0xA21F7CBF9C55C582ULL,
+      0x8C51618174C6FD30ULL },
+    { 0x0ULL, 0x8726263500CBB435ULL, 0x95AF707A8DD8DC41ULL,
+      0x0C0A46F1588B23B8ULL, 0x17D22C9292929E1EULL, 0xF8E7FAA4643AAE62ULL,
+      0xF2EF850A3B04CD84ULL, 0xF556D376E25F192BULL, 0x4BD1C18DE45A3A1BULL,
+      0xE1FA6A7F08E42F0FULL },
+};
+
+#endif
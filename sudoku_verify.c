@@ -0,0 +1,262 @@
+// Bulk verification - checks submitted grids (complete or partial) straight
+// from an 81-char line each, without building a SudokuGrid unless the
+// uniqueness check needs one.
+//
+// A record is one line: the grid, optionally followed by whitespace and the
+// original puzzle it was played from ('.' or '0' for empty in both).
+// Lines starting with '#' and empty lines are skipped. The file is mapped
+// (read in one go on Windows), the line starts are indexed in one pass and
+// the records are then checked in parallel, one error code each.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#ifdef _WIN32
+#define MAP_UNAVAILABLE
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "sudoku_advanced.h"
+#include "sudoku_tables.h"
+
+static const char *verify_code_names[VERIFY_CODES] = {
+    "ok", "partial", "bad_format", "conflict", "clue_mismatch", "no_solution", "not_unique"
+};
+
+const char *verify_code_name(int code) {
+    return code >= 0 && code < VERIFY_CODES ? verify_code_names[code] : "unknown";
+}
+
+// Digits of an 81-char field as a 0..9 array (0 = empty). Returns 0 if the
+// field isn't exactly 81 chars or has a bad character.
+static int read_digits(const char *text, int length, unsigned char *digits) {
+    if (length != NUM_CELLS) return 0;
+    for (int k = 0; k < NUM_CELLS; k++) {
+        char ch = text[k];
+        if (ch >= '1' && ch <= '9') digits[k] = ch - '0';
+        else if (ch == '.' || ch == '0') digits[k] = 0;
+        else return 0;
+    }
+    return 1;
+}
+
+// One bitmask per row, column and box: a digit whose bit is already set in
+// any of its three units is a conflict. Sets *complete if no cell is empty.
+static int digits_consistent(const unsigned char *digits, int *complete) {
+    unsigned short used[NUM_UNITS] = {0};
+    int empty = 0;
+    for (int k = 0; k < NUM_CELLS; k++) {
+        if (!digits[k]) {
+            empty++;
+            continue;
+        }
+        unsigned short bit = 1 << (digits[k] - 1);
+        const unsigned char *units = cell_units[k];
+        if ((used[units[0]] | used[units[1]] | used[units[2]]) & bit) return 0;
+        used[units[0]] |= bit;
+        used[units[1]] |= bit;
+        used[units[2]] |= bit;
+    }
+    *complete = empty == 0;
+    return 1;
+}
+
+int verify_record(const char *grid_text, int grid_length, const char *puzzle_text,
+                  int puzzle_length, int check_unique) {
+    unsigned char grid[NUM_CELLS], puzzle[NUM_CELLS];
+    int complete;
+
+    if (!read_digits(grid_text, grid_length, grid)) return VERIFY_BAD_FORMAT;
+    if (puzzle_text && !read_digits(puzzle_text, puzzle_length, puzzle)) return VERIFY_BAD_FORMAT;
+
+    // A changed clue usually clashes too, but the mismatch is the better report
+    if (puzzle_text) {
+        for (int k = 0; k < NUM_CELLS; k++) {
+            if (puzzle[k] && grid[k] != puzzle[k]) return VERIFY_CLUE_MISMATCH;
+        }
+    }
+    if (!digits_consistent(grid, &complete)) return VERIFY_CONFLICT;
+
+    if (check_unique) {
+        // The puzzle has to have exactly one solution (the grid itself if
+        // there's no puzzle), and a partial grid has to still lead to it
+        SudokuGrid g;
+        const unsigned char *source = puzzle_text ? puzzle : grid;
+        int *cells = &g.cells[0][0];
+        init_grid(&g);
+        g.empty_cells = 0;
+        for (int k = 0; k < NUM_CELLS; k++) {
+            cells[k] = source[k];
+            g.empty_cells += !source[k];
+        }
+        int solutions = count_solutions(&g, 2);
+        if (solutions == 0) return VERIFY_NO_SOLUTION;
+        if (solutions > 1) return VERIFY_NOT_UNIQUE;
+
+        if (puzzle_text && !complete) {
+            g.empty_cells = 0;
+            for (int k = 0; k < NUM_CELLS; k++) {
+                cells[k] = grid[k];
+                g.empty_cells += !grid[k];
+            }
+            if (count_solutions(&g, 1) == 0) return VERIFY_NO_SOLUTION;
+        }
+    }
+
+    return complete ? VERIFY_OK : VERIFY_PARTIAL;
+}
+
+// ========== Batch Files ==========
+
+typedef struct {
+    size_t offset;
+    unsigned int line;
+    unsigned int length;
+} RecordIndex;
+
+// Whole file in memory, mapped where possible
+static char *map_batch_file(const char *filename, size_t *size) {
+#ifdef MAP_UNAVAILABLE
+    FILE *file = fopen(filename, "rb");
+    if (!file) return NULL;
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc(*size + 1);
+    if (data && fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return NULL;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        *size = 0;
+        return malloc(1);  // mmap can't map nothing
+    }
+    *size = st.st_size;
+    char *data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return NULL;
+    madvise(data, *size, MADV_SEQUENTIAL);
+    return data;
+#endif
+}
+
+static void unmap_batch_file(char *data, size_t size) {
+#ifdef MAP_UNAVAILABLE
+    free(data);
+#else
+    if (size) munmap(data, size);
+    else free(data);
+#endif
+}
+
+// Starts of the record lines (comments and blank lines left out)
+static long long index_records(const char *data, size_t size, RecordIndex **index) {
+    long long count = 0, capacity = 1 << 16;
+    unsigned int line = 0;
+    *index = malloc(capacity * sizeof(RecordIndex));
+
+    for (size_t pos = 0; pos < size; ) {
+        const char *end = memchr(data + pos, '\n', size - pos);
+        size_t next = end ? (size_t)(end - data) + 1 : size;
+        size_t length = next - pos - (end != NULL);
+        if (length && data[pos + length - 1] == '\r') length--;
+        line++;
+
+        if (length && data[pos] != '#') {
+            if (count == capacity) {
+                capacity *= 2;
+                *index = realloc(*index, capacity * sizeof(RecordIndex));
+            }
+            if (!*index) {
+                printf("Error: Out of memory indexing the batch\n");
+                exit(1);
+            }
+            (*index)[count].offset = pos;
+            (*index)[count].line = line;
+            (*index)[count].length = length < 0xFFFFFFFF ? (unsigned int)length : 0xFFFFFFFF;
+            count++;
+        }
+        pos = next;
+    }
+    return count;
+}
+
+static int is_separator(char ch) {
+    return ch == ' ' || ch == '\t' || ch == ',';
+}
+
+// Splits a record into the grid and the optional puzzle after it. Trailing
+// blanks are dropped; anything else left over stays in a field, so a grid
+// or puzzle with extra characters comes out longer than 81 (bad_format).
+static const char *split_record(const char *text, unsigned int length, int *grid_length, int *puzzle_length) {
+    while (length && (text[length - 1] == ' ' || text[length - 1] == '\t')) length--;
+    unsigned int k = 0;
+    while (k < length && !is_separator(text[k])) k++;
+    *grid_length = k;
+    while (k < length && is_separator(text[k])) k++;
+    if (k >= length) return NULL;
+    *puzzle_length = length - k;
+    return text + k;
+}
+
+long long verify_batch_file(const char *filename, int check_unique, VerifyReport *report,
+                            unsigned char **codes, unsigned int **lines) {
+    memset(report, 0, sizeof(VerifyReport));
+    double start = omp_get_wtime();
+
+    size_t size;
+    char *data = map_batch_file(filename, &size);
+    if (!data) {
+        printf("Error: Could not open file %s\n", filename);
+        exit(1);
+    }
+
+    RecordIndex *index;
+    long long count = index_records(data, size, &index);
+    *codes = malloc(count ? count : 1);
+    if (!*codes) {
+        printf("Error: Out of memory for %lld records\n", count);
+        exit(1);
+    }
+
+    long long totals[VERIFY_CODES] = {0};
+    #pragma omp parallel for schedule(dynamic, 1024) reduction(+:totals[:VERIFY_CODES])
+    for (long long r = 0; r < count; r++) {
+        const char *text = data + index[r].offset;
+        int grid_length, puzzle_length = 0;
+        const char *puzzle = split_record(text, index[r].length, &grid_length, &puzzle_length);
+        int code = verify_record(text, grid_length, puzzle, puzzle_length, check_unique);
+        (*codes)[r] = code;
+        totals[code]++;
+    }
+
+    if (lines) {
+        *lines = malloc((count ? count : 1) * sizeof(unsigned int));
+        for (long long r = 0; r < count && *lines; r++) (*lines)[r] = index[r].line;
+    }
+    free(index);
+    unmap_batch_file(data, size);
+
+    report->records = count;
+    memcpy(report->counts, totals, sizeof(totals));
+    report->seconds = omp_get_wtime() - start;
+    report->threads = omp_get_max_threads();
+    return count;
+}
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Converts a search trace from a -DSUDOKU_TRACE build (output/trace_*.bin)
+# to Chrome trace JSON - open it in chrome://tracing or ui.perfetto.dev.
+# Also prints per-thread busy/idle time so load imbalance shows up without
+# opening the viewer.
+#
+# Usage: python trace_to_chrome.py output/trace_v1.bin [out.json] [--no-nodes]
+
+import json
+import struct
+import sys
+
+HEADER = struct.Struct('<8sIIdQ88s')
+THREAD = struct.Struct('<IIQQ')
+EVENT = struct.Struct('<QIHBx')
+
+SEARCH_BEGIN, SEARCH_END, NODE, TECHNIQUE, BRANCH, BACKTRACK, STEAL, CANCEL = range(8)
+TECHNIQUES = ['Naked singles', 'Hidden singles', 'Subsets', 'Pointing pairs', 'X-Wing', 'Swordfish',
+              'XY-Wing']
+OVER_BUDGET = 0xFFFFFFFF
+
+
+def read_trace(filename):
+    with open(filename, 'rb') as f:
+        data = f.read()
+
+    magic, version, threads, ticks_per_us, start, puzzle = HEADER.unpack_from(data, 0)
+    if magic != b'SDKTRACE' or version != 1:
+        print(f"Error: {filename} is not a version 1 solver trace")
+        raise SystemExit(1)
+
+    offset = HEADER.size
+    per_thread = []
+    for _ in range(threads):
+        thread, _pad, count, dropped = THREAD.unpack_from(data, offset)
+        offset += THREAD.size
+        events = [EVENT.unpack_from(data, offset + k * EVENT.size) for k in range(count)]
+        offset += count * EVENT.size
+        per_thread.append((thread, dropped, events))
+
+    return ticks_per_us, start, puzzle.rstrip(b'\0').decode(), per_thread
+
+
+def instant(name, tid, ts, args):
+    return {'name': name, 'ph': 'i', 's': 't', 'pid': 0, 'tid': tid, 'ts': ts, 'args': args}
+
+
+def convert(filename, with_nodes=True):
+    ticks_per_us, start, puzzle, per_thread = read_trace(filename)
+    us = lambda tsc: (tsc - start) / ticks_per_us
+
+    out = [{'name': 'process_name', 'ph': 'M', 'pid': 0, 'args': {'name': f'sudoku {puzzle}'}}]
+    end_of_trace = max((us(e[-1][0]) for _, _, e in per_thread if e), default=0)
+    summary = []
+
+    for thread, dropped, events in per_thread:
+        out.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': thread,
+                    'args': {'name': f'thread {thread}'}})
+        busy = 0.0
+        open_at = []
+        counts = {}
+
+        for k, (tsc, arg, _tid, kind) in enumerate(events):
+            ts = us(tsc)
+            counts[kind] = counts.get(kind, 0) + 1
+
+            if kind == SEARCH_BEGIN:
+                out.append({'name': 'search', 'ph': 'B', 'pid': 0, 'tid': thread, 'ts': ts})
+                open_at.append(ts)
+            elif kind == SEARCH_END:
+                result = 'over budget' if arg == OVER_BUDGET else arg
+                out.append({'name': 'search', 'ph': 'E', 'pid': 0, 'tid': thread, 'ts': ts,
+                            'args': {'result': result}})
+                if open_at:
+                    began = open_at.pop()
+                    if not open_at:
+                        busy += ts - began
+            elif kind == NODE:
+                # A node lasts until the thread's next node or the end of its search
+                if with_nodes:
+                    later = [e for e in events[k + 1:k + 64] if e[3] in (NODE, SEARCH_END)]
+                    dur = us(later[0][0]) - ts if later else 0
+                    out.append({'name': 'node', 'ph': 'X', 'pid': 0, 'tid': thread, 'ts': ts,
+                                'dur': dur, 'args': {'depth': arg}})
+            elif kind == TECHNIQUE:
+                name = TECHNIQUES[arg] if arg < len(TECHNIQUES) else f'technique {arg}'
+                out.append(instant(name, thread, ts, {}))
+            elif kind == BRANCH:
+                cell, value = divmod(arg, 16)
+                out.append(instant('branch', thread, ts, {'row': cell // 9, 'col': cell % 9, 'value': value}))
+            elif kind == BACKTRACK:
+                out.append(instant('backtrack', thread, ts, {'depth': arg}))
+            elif kind == STEAL:
+                out.append(instant('steal', thread, ts, {'from': arg}))
+            elif kind == CANCEL:
+                out.append(instant('cancel', thread, ts, {'depth': arg}))
+
+        # Still searching when the trace was taken (e.g. the ring wrapped)
+        if open_at:
+            busy += end_of_trace - open_at[0]
+        summary.append((thread, len(events), dropped, busy, counts))
+
+    return out, summary, end_of_trace
+
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    if not args:
+        print("Usage: python trace_to_chrome.py <trace.bin> [out.json] [--no-nodes]")
+        raise SystemExit(1)
+
+    source = args[0]
+    target = args[1] if len(args) > 1 else source.rsplit('.', 1)[0] + '.json'
+    events, summary, span = convert(source, with_nodes='--no-nodes' not in sys.argv)
+
+    with open(target, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, f)
+    print(f"Wrote {len(events)} events to {target}")
+
+    print(f"\n{'Thread':>6} {'Events':>8} {'Dropped':>8} {'Busy(us)':>10} {'Idle(us)':>10} "
+          f"{'Nodes':>8} {'Steals':>7} {'Cancels':>8}")
+    for thread, count, dropped, busy, counts in summary:
+        print(f"{thread:>6} {count:>8} {dropped:>8} {busy:>10.1f} {span - busy:>10.1f} "
+              f"{counts.get(NODE, 0):>8} {counts.get(STEAL, 0):>7} {counts.get(CANCEL, 0):>8}")
+
+
+if __name__ == "__main__":
+    main()